@@ -0,0 +1,264 @@
+#pragma once
+
+#include "classes/WheelCatalog.hpp"
+#include "classes/WheelRandom.hpp"
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <numeric>
+#include <optional>
+#include <sstream>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/**
+ * @brief A roulette wheel over the elements of a shared WheelCatalog (flyweight wheel).
+ *
+ * Regions hold a 32-bit item id and a weight instead of a copy of the element, so thousands of
+ * wheels over the same items store each item once. select() returns a reference into the
+ * catalog. A wheel is just two parallel vectors (ids and weights) and their total: draws
+ * scan the weights with the same loop as RouletteWheel's linear scan, and id lookups scan
+ * the ids, so adding, removing or looking up an id costs O(n). That suits the many small
+ * wheels this class is meant for; use RouletteWheel for a few large, heavily edited wheels.
+ *
+ * @tparam E Element type stored in the catalog
+ * @tparam W Weight type (must be numeric: int, float, double, etc.)
+ */
+template<typename E, typename W>
+class CatalogRouletteWheel {
+public:
+    using Catalog = WheelCatalog<E>;
+    using ItemId = typename Catalog::ItemId;
+
+    /*** Constructors ***/
+
+    /**
+     * @brief Creates an empty wheel over a catalog
+     * @param catalog The shared catalog (kept alive by the wheel)
+     * @throws std::invalid_argument if catalog is null
+     */
+    explicit CatalogRouletteWheel(std::shared_ptr<const Catalog> catalog)
+        : catalog(std::move(catalog)) {
+        if (!this->catalog) {
+            throw std::invalid_argument("CatalogRouletteWheel: catalog must not be null");
+        }
+    }
+
+    /*** Selection Methods ***/
+
+    /**
+     * @brief Selects an element using weighted random selection
+     * @return Const reference to the selected element in the catalog
+     * @throws std::runtime_error if the wheel is empty
+     */
+    const E& select() const {
+        return (*catalog)[selectId()];
+    }
+
+    /**
+     * @brief Selects an element's id using weighted random selection
+     * @return The selected id
+     * @throws std::runtime_error if the wheel is empty
+     */
+    ItemId selectId() const {
+        if (ids.empty()) {
+            throw std::runtime_error("CatalogRouletteWheel::select: wheel is empty");
+        }
+        return ids[selectSlot()];
+    }
+
+    /**
+     * @brief Selects an element's id and returns it as an optional (safe version)
+     * @return Optional containing the selected id, or nullopt if the wheel is empty
+     */
+    std::optional<ItemId> selectIdSafe() const {
+        if (ids.empty()) {
+            return std::nullopt;
+        }
+        return ids[selectSlot()];
+    }
+
+    /*** Modification Methods ***/
+
+    /**
+     * @brief Adds a catalog item to the wheel (weights of repeated ids are combined)
+     * @param id The item's catalog id
+     * @param weight The item's weight
+     * @throws std::out_of_range if id is not in the catalog
+     * @throws std::invalid_argument if weight is negative or zero
+     */
+    void addRegion(ItemId id, W weight) {
+        if (id >= catalog->size()) {
+            std::ostringstream msg;
+            msg << "CatalogRouletteWheel::addRegion: unknown item id " << id;
+            throw std::out_of_range(msg.str());
+        }
+        insertRegion(id, weight);
+    }
+
+    /**
+     * @brief Adds a catalog item to the wheel by value
+     * @param element An element equal to a catalog item
+     * @param weight The item's weight
+     * @throws std::invalid_argument if the element is not in the catalog, or weight is
+     *         negative or zero
+     */
+    void addRegion(const E& element, W weight) {
+        const auto id = catalog->find(element);
+        if (!id.has_value()) {
+            throw std::invalid_argument("CatalogRouletteWheel::addRegion: element is not in the catalog");
+        }
+        insertRegion(*id, weight);
+    }
+
+    /**
+     * @brief Removes a catalog item from the wheel
+     * @param id The item's catalog id
+     * @return true if the item was on the wheel and removed, false otherwise
+     */
+    bool removeElement(ItemId id) {
+        const auto slot = findSlot(id);
+        if (!slot.has_value()) {
+            return false;
+        }
+
+        const W removedWeight = weights[*slot];
+        ids.erase(ids.begin() + *slot);
+        weights.erase(weights.begin() + *slot);
+        // Integer totals are exact; floating-point totals are resummed so they never drift
+        if constexpr (std::is_integral_v<W>) {
+            totalWeight -= removedWeight;
+        } else {
+            totalWeight = std::accumulate(weights.begin(), weights.end(), W{0});
+        }
+        return true;
+    }
+
+    /**
+     * @brief Reserves storage for a number of regions
+     * @param capacity Expected number of regions
+     */
+    void reserve(size_t capacity) {
+        ids.reserve(capacity);
+        weights.reserve(capacity);
+    }
+
+    /*** Query Methods ***/
+
+    /**
+     * @brief Checks if the wheel has no regions
+     * @return true if empty, false otherwise
+     */
+    bool empty() const {
+        return ids.empty();
+    }
+
+    /**
+     * @brief Gets the number of regions in the wheel
+     * @return Number of regions
+     */
+    size_t size() const {
+        return ids.size();
+    }
+
+    /**
+     * @brief Calculates the selection probability for a catalog item
+     * @param id The item's catalog id
+     * @return Probability fraction (0.0 to 1.0), or 0.0 if the item is not on the wheel
+     */
+    double getSelectionProbability(ItemId id) const {
+        const auto slot = findSlot(id);
+        if (!slot.has_value()) {
+            return 0.0;
+        }
+        return static_cast<double>(weights[*slot]) / static_cast<double>(totalWeight);
+    }
+
+    /**
+     * @brief Gets the catalog the wheel draws from
+     * @return The shared catalog
+     */
+    const std::shared_ptr<const Catalog>& getCatalog() const {
+        return catalog;
+    }
+
+    /**
+     * @brief Gets the ids on the wheel, in the order they were added
+     * @return Const reference to the ids (parallel to getWeights())
+     */
+    const std::vector<ItemId>& getIds() const {
+        return ids;
+    }
+
+    /**
+     * @brief Gets the weights on the wheel
+     * @return Const reference to the weights (parallel to getIds())
+     */
+    const std::vector<W>& getWeights() const {
+        return weights;
+    }
+
+    /**
+     * @brief Seeds the shared random number generator for the current thread.
+     * @param seed The seed value
+     * @note The engine is shared by all wheels on the calling thread.
+     */
+    void seedRandom(unsigned int seed) {
+        WheelRandom::seed(seed);
+    }
+
+private:
+    /*** Member Variables ***/
+    std::shared_ptr<const Catalog> catalog;
+    std::vector<ItemId> ids;
+    std::vector<W> weights;
+    W totalWeight = W{0};
+
+    /*** Private Helper Methods ***/
+
+    /**
+     * @brief Finds the slot holding an id
+     * @param id The item's catalog id
+     * @return Optional containing the slot, or nullopt if the id is not on the wheel
+     */
+    std::optional<size_t> findSlot(ItemId id) const {
+        const auto found = std::find(ids.begin(), ids.end(), id);
+        if (found == ids.end()) {
+            return std::nullopt;
+        }
+        return static_cast<size_t>(found - ids.begin());
+    }
+
+    /**
+     * @brief Adds a known id, combining its weight into the slot that already holds it
+     * @param id The item's catalog id (must be in the catalog)
+     * @param weight The item's weight
+     * @throws std::invalid_argument if weight is negative or zero
+     */
+    void insertRegion(ItemId id, W weight) {
+        if (weight <= 0) {
+            std::ostringstream msg;
+            msg << "CatalogRouletteWheel::addRegion: weight must be positive, got " << weight;
+            throw std::invalid_argument(msg.str());
+        }
+
+        const auto slot = findSlot(id);
+        if (slot.has_value()) {
+            weights[*slot] += weight;
+        } else {
+            ids.push_back(id);
+            weights.push_back(weight);
+        }
+        totalWeight += weight;
+    }
+
+    /**
+     * @brief Draws a slot by weight (the wheel must not be empty)
+     * @return The selected slot
+     */
+    size_t selectSlot() const {
+        return WheelRandom::indexByWeight(ids.size(), [this](size_t i) { return weights[i]; }, totalWeight);
+    }
+};
@@ -0,0 +1,414 @@
+#pragma once
+
+#include "RouletteWheel.hpp"
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <sstream>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+/**
+ * @brief A copy-on-write roulette wheel for many cheap variants of one base wheel.
+ *
+ * Copies share an immutable base RouletteWheel, including its cached selection engine, so
+ * copying costs a reference count and a few small vectors. Edits are kept in a per-copy
+ * overlay: base regions whose weight was overridden (or removed), plus regions added on top.
+ * A draw first decides between the overlay's weight and the untouched part of the base, then
+ * picks within the overlay by scanning it, or from the base with RouletteWheel::selectExcluding
+ * skipping the overridden regions (O(k log n) for k overrides).
+ *
+ * Once the overlay outgrows a small fraction of the base, the copy folds it into a private
+ * base in O(n) and starts a new, empty overlay.
+ *
+ * @tparam E Element type to store
+ * @tparam W Weight type (must be numeric: int, float, double, etc.)
+ * @note The base's lazily built caches are shared too, so copies that share a base must be
+ *       used from one thread at a time.
+ */
+template<typename E, typename W>
+class CowRouletteWheel {
+public:
+    using Wheel = RouletteWheel<E, W>;
+
+    /*** Constructors ***/
+
+    /**
+     * @brief Creates a copy-on-write wheel from a wheel (which becomes the shared base)
+     * @param wheel The base wheel
+     * @throws std::invalid_argument if the wheel has a weight scale, offset or temperature
+     */
+    explicit CowRouletteWheel(Wheel wheel)
+        : CowRouletteWheel(std::make_shared<const Wheel>(std::move(wheel))) {
+    }
+
+    /**
+     * @brief Creates a copy-on-write wheel over an already shared base
+     * @param base The base wheel
+     * @throws std::invalid_argument if base is null or has a weight scale, offset or temperature
+     */
+    explicit CowRouletteWheel(std::shared_ptr<const Wheel> base)
+        : base(std::move(base)) {
+        if (!this->base) {
+            throw std::invalid_argument("CowRouletteWheel: base wheel must not be null");
+        }
+        if (this->base->getWeightScale() != 1.0 || this->base->getWeightOffset() != 0.0
+            || this->base->getTemperature() != 1.0) {
+            throw std::invalid_argument("CowRouletteWheel: base wheel must not have weight transforms");
+        }
+        baseTotal = sumBaseWeights();
+    }
+
+    /*** Selection Methods ***/
+
+    /**
+     * @brief Selects an element using weighted random selection
+     * @return The selected element
+     * @throws std::runtime_error if the wheel is empty
+     */
+    E select() const {
+        if (empty()) {
+            throw std::runtime_error("CowRouletteWheel::select: wheel is empty");
+        }
+        if (overrides.empty() && additions.empty()) {
+            return base->select();
+        }
+
+        const W untouchedWeight = overriddenIndices.size() == base->size()
+            ? W{0} : baseTotal - replacedWeight;
+        W randomValue = WheelRandom::weightBelow(untouchedWeight + overlayWeight);
+        if (randomValue < overlayWeight) {
+            for (const Override& entry : overrides) {
+                if (randomValue < entry.weight) {
+                    return base->getRegions()[entry.index].getElement();
+                }
+                randomValue -= entry.weight;
+            }
+            for (const WheelRegion<E, W>& region : additions) {
+                if (randomValue < region.getWeight()) {
+                    return region.getElement();
+                }
+                randomValue -= region.getWeight();
+            }
+        }
+        if (untouchedWeight == W{0}) {
+            // Rounding carried randomValue past the overlay, and there is no base region left
+            // to fall through to
+            return lastOverlayElement();
+        }
+        return base->selectExcluding(overriddenIndices);
+    }
+
+    /**
+     * @brief Selects an element and returns it as an optional (safe version)
+     * @return Optional containing the selected element, or nullopt if the wheel is empty
+     */
+    std::optional<E> selectSafe() const {
+        if (empty()) {
+            return std::nullopt;
+        }
+        return select();
+    }
+
+    /*** Modification Methods ***/
+
+    /**
+     * @brief Adds a region to this copy, or adds weight to an existing one
+     * @param element The element
+     * @param weight The weight to add
+     * @throws std::invalid_argument if weight is negative or zero
+     */
+    void addRegion(const E& element, W weight) {
+        validateWeight(weight, "addRegion");
+
+        if (WheelRegion<E, W>* region = findAddition(element)) {
+            region->setWeight(region->getWeight() + weight);
+        } else if (const auto index = base->indexOf(element)) {
+            writeOverride(*index, currentBaseWeight(*index) + weight);
+        } else {
+            additions.emplace_back(element, weight);
+        }
+        onOverlayChanged();
+    }
+
+    /**
+     * @brief Replaces an element's weight in this copy
+     * @param element The element
+     * @param weight The new weight
+     * @return true if the element was on the wheel, false otherwise
+     * @throws std::invalid_argument if weight is negative or zero
+     */
+    bool setWeight(const E& element, W weight) {
+        validateWeight(weight, "setWeight");
+
+        if (WheelRegion<E, W>* region = findAddition(element)) {
+            region->setWeight(weight);
+        } else if (const auto index = base->indexOf(element); index && currentBaseWeight(*index) > W{0}) {
+            writeOverride(*index, weight);
+        } else {
+            return false;
+        }
+        onOverlayChanged();
+        return true;
+    }
+
+    /**
+     * @brief Removes an element from this copy (other copies keep it)
+     * @param element The element to remove
+     * @return true if the element was found and removed, false otherwise
+     */
+    bool removeElement(const E& element) {
+        if (WheelRegion<E, W>* region = findAddition(element)) {
+            additions.erase(additions.begin() + (region - additions.data()));
+        } else if (const auto index = base->indexOf(element); index && currentBaseWeight(*index) > W{0}) {
+            writeOverride(*index, W{0});
+        } else {
+            return false;
+        }
+        onOverlayChanged();
+        return true;
+    }
+
+    /**
+     * @brief Folds the overlay into a private copy of the base
+     *
+     * The copy keeps the base's options (including a pinned or automatic strategy), allocator
+     * and engine state; the overrides are written into it by index and the removals and
+     * additions applied as one batch edit. Costs O(n) plus a lookup per removal and addition,
+     * which is O(1) when the base sets Options::indexElements and O(n) otherwise.
+     *
+     * Happens automatically once the overlay grows too large; call it directly before
+     * drawing many times from a heavily edited copy.
+     */
+    void detach() {
+        Wheel merged(*base);
+        for (const Override& entry : overrides) {
+            if (entry.weight > W{0}) {
+                merged.setWeightAt(entry.index, entry.weight);
+            }
+        }
+        merged.edit([&](auto& batch) {
+            batch.reserve(additions.size());
+            for (const Override& entry : overrides) {
+                if (entry.weight == W{0}) {
+                    batch.removeElement(base->getRegions()[entry.index].getElement());
+                }
+            }
+            for (const WheelRegion<E, W>& region : additions) {
+                batch.addRegion(region.getElement(), region.getWeight());
+            }
+        });
+
+        base = std::make_shared<const Wheel>(std::move(merged));
+        baseTotal = sumBaseWeights();
+        overrides.clear();
+        overriddenIndices.clear();
+        additions.clear();
+        onOverlayChanged();
+    }
+
+    /*** Query Methods ***/
+
+    /**
+     * @brief Checks if the wheel has no regions
+     * @return true if empty, false otherwise
+     */
+    bool empty() const {
+        return size() == 0;
+    }
+
+    /**
+     * @brief Gets the number of regions in this copy
+     * @return Number of regions
+     */
+    size_t size() const {
+        return base->size() - removedCount + additions.size();
+    }
+
+    /**
+     * @brief Gets an element's weight in this copy
+     * @param element The element
+     * @return The weight, or 0 if the element is not on the wheel
+     */
+    W getWeight(const E& element) const {
+        for (const WheelRegion<E, W>& region : additions) {
+            if (region.getElement() == element) {
+                return region.getWeight();
+            }
+        }
+        const auto index = base->indexOf(element);
+        return index.has_value() ? currentBaseWeight(*index) : W{0};
+    }
+
+    /**
+     * @brief Gets the sum of this copy's weights
+     * @return Total weight
+     */
+    W getTotalWeight() const {
+        return baseTotal - replacedWeight + overlayWeight;
+    }
+
+    /**
+     * @brief Calculates the selection probability for an element
+     * @param element The element to query
+     * @return Probability fraction (0.0 to 1.0), or 0.0 if element not found
+     */
+    double getSelectionProbability(const E& element) const {
+        const W totalWeight = getTotalWeight();
+        if (totalWeight <= W{0}) {
+            return 0.0;
+        }
+        return static_cast<double>(getWeight(element)) / static_cast<double>(totalWeight);
+    }
+
+    /**
+     * @brief Gets the number of overridden, removed and added regions held by this copy
+     * @return Overlay size
+     */
+    size_t overlaySize() const {
+        return overrides.size() + additions.size();
+    }
+
+    /**
+     * @brief Checks whether this copy still shares its base with another
+     * @param other The other wheel
+     * @return true if both draw from the same base wheel
+     */
+    bool sharesBaseWith(const CowRouletteWheel& other) const {
+        return base == other.base;
+    }
+
+    /**
+     * @brief Gets the shared base wheel (without this copy's overlay)
+     * @return Const reference to the base wheel
+     */
+    const Wheel& getBase() const {
+        return *base;
+    }
+
+    /**
+     * @brief Seeds the shared random number generator for the current thread.
+     * @param seed The seed value
+     * @note The engine is shared by all wheels on the calling thread.
+     */
+    void seedRandom(unsigned int seed) {
+        WheelRandom::seed(seed);
+    }
+
+private:
+    struct Override {
+        size_t index; ///< Index of the base region
+        W weight;     ///< Weight in this copy (0 if removed)
+    };
+
+    /// Overlays never grow past this size before being folded into a private base
+    static constexpr size_t minimumOverlayLimit = 8;
+    /// Larger bases allow one overlay entry per this many base regions
+    static constexpr size_t overlayDivisor = 16;
+
+    /*** Member Variables ***/
+    std::shared_ptr<const Wheel> base;
+    W baseTotal = W{0};
+    std::vector<Override> overrides;          ///< Sorted by base index
+    std::vector<size_t> overriddenIndices;    ///< The same indices, for selectExcluding
+    std::vector<WheelRegion<E, W>> additions; ///< Regions that are not in the base
+    W overlayWeight = W{0};   ///< Weight of the overrides plus the additions
+    W replacedWeight = W{0};  ///< Base weight of the overridden regions
+    size_t removedCount = 0;
+
+    /*** Private Helper Methods ***/
+
+    /**
+     * @brief Gets a base region's weight in this copy
+     * @param index Index of the base region
+     * @return The overriding weight if there is one, else the base weight
+     */
+    W currentBaseWeight(size_t index) const {
+        const auto found = findOverride(index);
+        return found != overrides.end() && found->index == index
+            ? found->weight : base->getRegions()[index].getWeight();
+    }
+
+    typename std::vector<Override>::const_iterator findOverride(size_t index) const {
+        return std::lower_bound(overrides.begin(), overrides.end(), index,
+                                [](const Override& entry, size_t value) { return entry.index < value; });
+    }
+
+    void writeOverride(size_t index, W weight) {
+        const auto found = findOverride(index);
+        if (found != overrides.end() && found->index == index) {
+            overrides[found - overrides.begin()].weight = weight;
+            return;
+        }
+        overriddenIndices.insert(overriddenIndices.begin() + (found - overrides.begin()), index);
+        overrides.insert(found, Override{index, weight});
+    }
+
+    /**
+     * @brief Gets the last overlay region that can be selected
+     * @return The last addition, or else the last override, with a positive weight
+     * @throws std::runtime_error if no overlay region has a positive weight
+     */
+    const E& lastOverlayElement() const {
+        for (auto region = additions.rbegin(); region != additions.rend(); ++region) {
+            if (region->getWeight() > W{0}) {
+                return region->getElement();
+            }
+        }
+        for (auto entry = overrides.rbegin(); entry != overrides.rend(); ++entry) {
+            if (entry->weight > W{0}) {
+                return base->getRegions()[entry->index].getElement();
+            }
+        }
+        throw std::runtime_error("CowRouletteWheel::select: wheel is empty");
+    }
+
+    WheelRegion<E, W>* findAddition(const E& element) {
+        for (WheelRegion<E, W>& region : additions) {
+            if (region.getElement() == element) {
+                return &region;
+            }
+        }
+        return nullptr;
+    }
+
+    /**
+     * @brief Recomputes the overlay totals (exactly, since the overlay is small) and folds the
+     *        overlay into a private base once it grows too large
+     */
+    void onOverlayChanged() {
+        overlayWeight = W{0};
+        replacedWeight = W{0};
+        removedCount = 0;
+        for (const Override& entry : overrides) {
+            overlayWeight += entry.weight;
+            replacedWeight += base->getRegions()[entry.index].getWeight();
+            removedCount += entry.weight == W{0};
+        }
+        for (const WheelRegion<E, W>& region : additions) {
+            overlayWeight += region.getWeight();
+        }
+
+        if (overlaySize() > std::max(minimumOverlayLimit, base->size() / overlayDivisor)) {
+            detach();
+        }
+    }
+
+    W sumBaseWeights() const {
+        W total = W{0};
+        for (const WheelRegion<E, W>& region : base->getRegions()) {
+            total += region.getWeight();
+        }
+        return total;
+    }
+
+    static void validateWeight(W weight, const char* caller) {
+        if (weight <= 0) {
+            std::ostringstream msg;
+            msg << "CowRouletteWheel::" << caller << ": weight must be positive, got " << weight;
+            throw std::invalid_argument(msg.str());
+        }
+    }
+};
@@ -0,0 +1,359 @@
+#pragma once
+
+#include "classes/ElementIndex.hpp"
+#include "classes/FenwickTree.hpp"
+#include "classes/WheelRandom.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <optional>
+#include <sstream>
+#include <stdexcept>
+#include <vector>
+
+/**
+ * @brief A roulette wheel whose weights decay exponentially over time without being rewritten.
+ *
+ * Each region has a decaying weight, which falls by a factor of e every 1 / decayRate time
+ * units, and an optional base weight that never decays (e.g. a novelty bonus on top of a
+ * permanent weight). Time only moves when the caller advances it.
+ *
+ * A decaying weight w written at time t is stored once as w * exp(decayRate * (t - t0)) for a
+ * shared reference time t0. Every stored value then shares the same factor
+ * exp(-decayRate * (now - t0)), so advancing time is O(1) and untouched regions cost nothing.
+ * Stored values are kept in Fenwick trees, making selection and every edit O(log n). Only a
+ * write far enough from t0 to risk overflow rebases the stored values, in O(n).
+ *
+ * @tparam E Element type to store
+ */
+template<typename E>
+class DecayingRouletteWheel {
+public:
+    /*** Constructors ***/
+
+    /**
+     * @brief Creates an empty wheel at time 0
+     * @param decayRate Decay rate per time unit (a half-life h corresponds to ln(2) / h);
+     *        0 disables decay
+     * @throws std::invalid_argument if decayRate is negative or not finite
+     */
+    explicit DecayingRouletteWheel(double decayRate)
+        : decayRate(decayRate) {
+        if (!(decayRate >= 0.0) || !std::isfinite(decayRate)) {
+            std::ostringstream msg;
+            msg << "DecayingRouletteWheel: decay rate must be non-negative and finite, got " << decayRate;
+            throw std::invalid_argument(msg.str());
+        }
+    }
+
+    /*** Selection Methods ***/
+
+    /**
+     * @brief Selects an element in proportion to its current effective weight
+     * @return The selected element
+     * @throws std::runtime_error if the wheel is empty or every weight was set to 0
+     */
+    E select() const {
+        if (regions.empty()) {
+            throw std::runtime_error("DecayingRouletteWheel::select: wheel is empty");
+        }
+
+        // Without base weights the shared decay factor cancels out, so draw in stored units
+        // (this also keeps long-untouched wheels exact when the factor underflows)
+        const double storedDecayingTotal = decayingWeights.getTotal();
+        const double baseTotal = baseWeights.getTotal();
+        if (storedDecayingTotal <= 0.0 && baseTotal <= 0.0) {
+            throw std::runtime_error("DecayingRouletteWheel::select: no region has positive weight");
+        }
+        if (baseTotal <= 0.0) {
+            return regions[decayingWeights.find(WheelRandom::weightBelow(storedDecayingTotal))].element;
+        }
+
+        const double factor = decayFactor();
+        const double randomValue = WheelRandom::weightBelow(baseTotal + storedDecayingTotal * factor);
+        if (randomValue < baseTotal || factor <= 0.0) {
+            return regions[baseWeights.find(std::min(randomValue, baseTotal))].element;
+        }
+        return regions[decayingWeights.find((randomValue - baseTotal) / factor)].element;
+    }
+
+    /**
+     * @brief Selects an element and returns it as an optional (safe version)
+     * @return Optional containing the selected element, or nullopt if the wheel is empty
+     */
+    std::optional<E> selectSafe() const {
+        if (regions.empty()) {
+            return std::nullopt;
+        }
+        return select();
+    }
+
+    /*** Modification Methods ***/
+
+    /**
+     * @brief Adds weight to an element as of the current time, creating its region if needed
+     * @param element The element
+     * @param weight Weight that starts decaying now (must be non-negative)
+     * @param baseWeight Weight that never decays (must be non-negative)
+     * @throws std::invalid_argument if either weight is negative or a new region would have
+     *         no weight at all
+     */
+    void addRegion(const E& element, double weight, double baseWeight = 0.0) {
+        validateWeight(weight, "addRegion");
+        validateWeight(baseWeight, "addRegion");
+
+        const auto index = elementIndex.find(element, regions, regions.size());
+        if (index.has_value()) {
+            setStoredWeights(*index, regions[*index].storedWeight + toStoredWeight(weight),
+                             regions[*index].baseWeight + baseWeight);
+            return;
+        }
+        if (weight + baseWeight <= 0.0) {
+            throw std::invalid_argument("DecayingRouletteWheel::addRegion: a new region needs a positive weight");
+        }
+
+        regions.push_back(Region{element, toStoredWeight(weight), baseWeight});
+        decayingWeights.pushBack(regions.back().storedWeight);
+        baseWeights.pushBack(baseWeight);
+        elementIndex.onAppend(element, regions.size() - 1);
+    }
+
+    /**
+     * @brief Resets an element's decaying weight to a value as of the current time
+     * @param element The element
+     * @param weight The new decaying weight (must be non-negative)
+     * @return true if the element was found, false otherwise
+     * @throws std::invalid_argument if weight is negative
+     */
+    bool setWeight(const E& element, double weight) {
+        validateWeight(weight, "setWeight");
+
+        const auto index = elementIndex.find(element, regions, regions.size());
+        if (!index.has_value()) {
+            return false;
+        }
+        setStoredWeights(*index, toStoredWeight(weight), regions[*index].baseWeight);
+        return true;
+    }
+
+    /**
+     * @brief Removes an element from the wheel (the last region takes its place)
+     * @param element The element to remove
+     * @return true if the element was found and removed, false otherwise
+     */
+    bool removeElement(const E& element) {
+        const auto index = elementIndex.find(element, regions, regions.size());
+        if (!index.has_value()) {
+            return false;
+        }
+
+        const size_t last = regions.size() - 1;
+        if (*index != last) {
+            setStoredWeights(*index, regions[last].storedWeight, regions[last].baseWeight);
+            elementIndex.onSwapErase(regions[*index].element, regions[last].element, *index, last);
+            regions[*index].element = std::move(regions[last].element);
+        } else {
+            elementIndex.onErase(regions[last].element, last, regions.size());
+        }
+        decayingWeights.popBack(regions[last].storedWeight);
+        baseWeights.popBack(regions[last].baseWeight);
+        regions.pop_back();
+        return true;
+    }
+
+    /**
+     * @brief Moves the wheel's clock forward in O(1)
+     * @param time The new current time
+     * @throws std::invalid_argument if time is earlier than the current time
+     */
+    void advanceTo(double time) {
+        if (!(time >= now)) {
+            std::ostringstream msg;
+            msg << "DecayingRouletteWheel::advanceTo: time cannot move backwards (from " << now
+                << " to " << time << ")";
+            throw std::invalid_argument(msg.str());
+        }
+        now = time;
+    }
+
+    /**
+     * @brief Moves the wheel's clock forward by an interval in O(1)
+     * @param elapsed Time to advance by (must be non-negative)
+     * @throws std::invalid_argument if elapsed is negative
+     */
+    void advanceBy(double elapsed) {
+        advanceTo(now + elapsed);
+    }
+
+    /*** Query Methods ***/
+
+    /**
+     * @brief Checks if the wheel has no regions
+     * @return true if empty, false otherwise
+     */
+    bool empty() const {
+        return regions.empty();
+    }
+
+    /**
+     * @brief Gets the number of regions in the wheel
+     * @return Number of regions
+     */
+    size_t size() const {
+        return regions.size();
+    }
+
+    /**
+     * @brief Gets the current time
+     * @return The time last passed to advanceTo (0 initially)
+     */
+    double getTime() const {
+        return now;
+    }
+
+    /**
+     * @brief Gets the decay rate per time unit
+     * @return The decay rate
+     */
+    double getDecayRate() const {
+        return decayRate;
+    }
+
+    /**
+     * @brief Gets an element's effective weight at the current time
+     * @param element The element
+     * @return Base weight plus the decayed weight, or 0.0 if the element is not on the wheel
+     */
+    double getWeight(const E& element) const {
+        const auto index = elementIndex.find(element, regions, regions.size());
+        if (!index.has_value()) {
+            return 0.0;
+        }
+        return regions[*index].baseWeight + regions[*index].storedWeight * decayFactor();
+    }
+
+    /**
+     * @brief Gets the sum of all effective weights at the current time
+     * @return Total weight
+     */
+    double getTotalWeight() const {
+        return baseWeights.getTotal() + decayingWeights.getTotal() * decayFactor();
+    }
+
+    /**
+     * @brief Calculates the selection probability for an element at the current time
+     * @param element The element to query
+     * @return Probability fraction (0.0 to 1.0), or 0.0 if element not found
+     */
+    double getSelectionProbability(const E& element) const {
+        const auto index = elementIndex.find(element, regions, regions.size());
+        if (!index.has_value()) {
+            return 0.0;
+        }
+        if (baseWeights.getTotal() <= 0.0) {
+            return regions[*index].storedWeight / decayingWeights.getTotal();
+        }
+        return getWeight(element) / getTotalWeight();
+    }
+
+    /**
+     * @brief Seeds the shared random number generator for the current thread.
+     * @param seed The seed value
+     * @note The engine is shared by all wheels on the calling thread.
+     */
+    void seedRandom(unsigned int seed) {
+        WheelRandom::seed(seed);
+    }
+
+private:
+    struct Region {
+        E element;
+        double storedWeight; ///< Decaying weight scaled to the reference time
+        double baseWeight;   ///< Weight that never decays
+
+        const E& getElement() const {
+            return element;
+        }
+    };
+
+    /// Stored weights are rebased once a write lands this many e-foldings after the reference time
+    static constexpr double maximumExponent = 64.0;
+
+    /*** Member Variables ***/
+    double decayRate;
+    double now = 0.0;
+    double referenceTime = 0.0;
+    std::vector<Region> regions;
+    FenwickTree<double> decayingWeights;
+    FenwickTree<double> baseWeights;
+    size_t updatesSinceBuild = 0;
+    ElementIndex<E> elementIndex;
+
+    /*** Private Helper Methods ***/
+
+    /**
+     * @brief Gets the factor that converts stored weights into effective weights now
+     * @return exp(-decayRate * (now - referenceTime))
+     */
+    double decayFactor() const {
+        return std::exp(-decayRate * (now - referenceTime));
+    }
+
+    /**
+     * @brief Converts a weight written now into stored units, rebasing first if the
+     *        conversion factor would grow too large
+     * @param weight Effective weight as of now
+     * @return The stored weight
+     */
+    double toStoredWeight(double weight) {
+        if (decayRate * (now - referenceTime) > maximumExponent) {
+            rebase();
+        }
+        return weight / decayFactor();
+    }
+
+    /**
+     * @brief Moves the reference time to now, folding the shared decay factor into every
+     *        stored weight (weights decayed below the smallest double become 0)
+     */
+    void rebase() {
+        const double factor = decayFactor();
+        for (Region& region : regions) {
+            region.storedWeight *= factor;
+        }
+        referenceTime = now;
+        rebuildTrees();
+    }
+
+    /**
+     * @brief Writes a region's stored weights into the trees
+     * @param index Index of the region
+     * @param storedWeight The new stored decaying weight
+     * @param baseWeight The new base weight
+     */
+    void setStoredWeights(size_t index, double storedWeight, double baseWeight) {
+        decayingWeights.add(index, storedWeight - regions[index].storedWeight);
+        baseWeights.add(index, baseWeight - regions[index].baseWeight);
+        regions[index].storedWeight = storedWeight;
+        regions[index].baseWeight = baseWeight;
+
+        // Floating-point deltas accumulate rounding error; rebuild once per n updates
+        if (++updatesSinceBuild >= regions.size()) {
+            rebuildTrees();
+        }
+    }
+
+    void rebuildTrees() {
+        decayingWeights.build(regions.size(), [this](size_t i) { return regions[i].storedWeight; });
+        baseWeights.build(regions.size(), [this](size_t i) { return regions[i].baseWeight; });
+        updatesSinceBuild = 0;
+    }
+
+    static void validateWeight(double weight, const char* caller) {
+        if (!(weight >= 0.0) || !std::isfinite(weight)) {
+            std::ostringstream msg;
+            msg << "DecayingRouletteWheel::" << caller << ": weight must be non-negative and finite, got " << weight;
+            throw std::invalid_argument(msg.str());
+        }
+    }
+};
@@ -0,0 +1,262 @@
+#pragma once
+
+#include "classes/FenwickTree.hpp"
+#include "classes/WheelRandom.hpp"
+#include "classes/WheelRegion.hpp"
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <sstream>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/**
+ * @brief A roulette wheel that is drawn down without replacement and then reset, like a deck.
+ *
+ * Regions are never erased. selectAndRemove() only marks its region inactive, by swapping
+ * the region's slot in a permutation past the active ones, and reset() makes every region
+ * active again. Elements are never copied, moved or reallocated by a draw or a reset.
+ *
+ * When every region has the same weight (e.g. a standard deck), a draw is one random index
+ * and reset() is O(1). Otherwise a Fenwick tree over the slots makes a draw O(log n), and
+ * reset() restores only the drawn slots, in O(removed log n) (or an O(n) rebuild when most
+ * of the deck was drawn).
+ *
+ * Regions are not merged: adding an element twice adds two cards.
+ *
+ * @tparam E Element type to store
+ * @tparam W Weight type (must be numeric: int, float, double, etc.)
+ */
+template<typename E, typename W>
+class DepletableRouletteWheel {
+public:
+    /*** Constructors ***/
+
+    /**
+     * @brief Default constructor - creates an empty wheel
+     */
+    DepletableRouletteWheel() = default;
+
+    /**
+     * @brief Constructs a wheel from a vector of element-weight tuples
+     * @param elementWeightPairs Vector of (element, weight) tuples, one per region
+     * @throws std::invalid_argument if a weight is negative or zero
+     */
+    explicit DepletableRouletteWheel(const std::vector<std::tuple<E, W>>& elementWeightPairs) {
+        regions.reserve(elementWeightPairs.size());
+        order.reserve(elementWeightPairs.size());
+        for (const auto& [element, weight] : elementWeightPairs) {
+            addRegion(element, weight);
+        }
+    }
+
+    /*** Selection Methods ***/
+
+    /**
+     * @brief Selects an active element without removing it
+     * @return Reference to the selected element (valid until the next addRegion)
+     * @throws std::runtime_error if no region is active
+     */
+    const E& select() const {
+        return regions[order[selectSlot("select")]].getElement();
+    }
+
+    /**
+     * @brief Selects an active element and marks its region inactive until reset()
+     * @return Reference to the selected element (valid until the next addRegion)
+     * @throws std::runtime_error if no region is active
+     */
+    const E& selectAndRemove() {
+        const size_t slot = selectSlot("selectAndRemove");
+        const size_t last = activeCount - 1;
+        const std::uint32_t drawn = order[slot];
+
+        if (!uniformWeights) {
+            // Slot gets the last active region's weight; the last active slot becomes inactive
+            const W lastWeight = regions[order[last]].getWeight();
+            if (slot != last) {
+                tree.add(slot, lastWeight - regions[drawn].getWeight());
+            }
+            tree.add(last, -lastWeight);
+            ++treeUpdatesSinceBuild;
+        }
+        std::swap(order[slot], order[last]);
+        --activeCount;
+        return regions[drawn].getElement();
+    }
+
+    /*** Modification Methods ***/
+
+    /**
+     * @brief Adds an active region
+     * @param element The element to add
+     * @param weight The weight for this element (must be positive)
+     * @throws std::invalid_argument if weight is negative or zero
+     */
+    void addRegion(E element, W weight) {
+        if (weight <= 0) {
+            std::ostringstream msg;
+            msg << "DepletableRouletteWheel::addRegion: weight must be positive, got " << weight;
+            throw std::invalid_argument(msg.str());
+        }
+
+        regions.emplace_back(std::move(element), weight);
+        order.push_back(static_cast<std::uint32_t>(regions.size() - 1));
+        // Keep active slots first: the new slot trades places with the first inactive one
+        std::swap(order.back(), order[activeCount]);
+        ++activeCount;
+
+        if (uniformWeights && weight != regions.front().getWeight()) {
+            uniformWeights = false;
+            rebuildTree();
+        } else if (!uniformWeights) {
+            // The new last slot holds the displaced inactive region (or the new one), weighted 0
+            tree.pushBack(W{0});
+            tree.add(activeCount - 1, weight);
+        }
+    }
+
+    /**
+     * @brief Makes every removed region active again
+     *
+     * O(1) when all weights are equal, otherwise O(removed log n) or an O(n) rebuild,
+     * whichever is cheaper.
+     */
+    void reset() {
+        const size_t removed = order.size() - activeCount;
+        activeCount = order.size();
+        if (uniformWeights || removed == 0) {
+            return;
+        }
+
+        size_t depth = 1;
+        while ((size_t{1} << depth) < order.size()) {
+            ++depth;
+        }
+        if (removed * depth >= order.size() || (std::is_floating_point_v<W> && treeUpdatesSinceBuild > order.size())) {
+            rebuildTree();
+            return;
+        }
+        for (size_t slot = order.size() - removed; slot < order.size(); ++slot) {
+            tree.add(slot, regions[order[slot]].getWeight());
+        }
+        treeUpdatesSinceBuild += removed;
+    }
+
+    /**
+     * @brief Removes every region, active or not
+     */
+    void clear() {
+        regions.clear();
+        order.clear();
+        tree.clear();
+        activeCount = 0;
+        uniformWeights = true;
+        treeUpdatesSinceBuild = 0;
+    }
+
+    /**
+     * @brief Reserves storage for at least the given number of regions
+     * @param capacity Number of regions to reserve room for
+     */
+    void reserve(size_t capacity) {
+        regions.reserve(capacity);
+        order.reserve(capacity);
+    }
+
+    /*** Query Methods ***/
+
+    /**
+     * @brief Checks if no region is active
+     * @return true if every region was drawn (or there are none), false otherwise
+     */
+    bool empty() const {
+        return activeCount == 0;
+    }
+
+    /**
+     * @brief Gets the number of active regions
+     * @return Number of regions that can still be drawn
+     */
+    size_t size() const {
+        return activeCount;
+    }
+
+    /**
+     * @brief Gets the number of regions removed since the last reset()
+     * @return Number of inactive regions
+     */
+    size_t removedCount() const {
+        return order.size() - activeCount;
+    }
+
+    /**
+     * @brief Gets the number of regions, active or not
+     * @return Number of regions reset() restores the wheel to
+     */
+    size_t fullSize() const {
+        return regions.size();
+    }
+
+    /**
+     * @brief Gets the summed weight of the active regions
+     * @return Active weight
+     */
+    W getActiveWeight() const {
+        if (uniformWeights) {
+            return activeCount == 0 ? W{0} : regions.front().getWeight() * static_cast<W>(activeCount);
+        }
+        return tree.getTotal();
+    }
+
+    /**
+     * @brief Gets all regions, active or not, in the order they were added
+     * @return Const reference to the regions
+     */
+    const std::vector<WheelRegion<E, W>>& getRegions() const {
+        return regions;
+    }
+
+    /**
+     * @brief Seeds the shared random number generator for the current thread.
+     * @param seed The seed value
+     * @note The engine is shared by all wheels on the calling thread.
+     */
+    void seedRandom(unsigned int seed) {
+        WheelRandom::seed(seed);
+    }
+
+private:
+    /*** Member Variables ***/
+    std::vector<WheelRegion<E, W>> regions; ///< Every region, in insertion order (never moved)
+    std::vector<std::uint32_t> order;       ///< Region per slot; slots [0, activeCount) are active
+    FenwickTree<W> tree;                    ///< Slot weights, 0 for inactive slots (unused while uniform)
+    size_t activeCount = 0;
+    bool uniformWeights = true;
+    size_t treeUpdatesSinceBuild = 0;
+
+    /*** Private Helper Methods ***/
+
+    size_t selectSlot(const char* caller) const {
+        if (activeCount == 0) {
+            std::ostringstream msg;
+            msg << "DepletableRouletteWheel::" << caller << ": no region is active";
+            throw std::runtime_error(msg.str());
+        }
+        if (uniformWeights) {
+            return WheelRandom::indexBelow(activeCount);
+        }
+        // Rounding can push the search past the active slots, whose weights are all zero
+        return std::min(tree.find(WheelRandom::weightBelow(tree.getTotal())), activeCount - 1);
+    }
+
+    void rebuildTree() {
+        tree.build(order.size(), [this](size_t slot) {
+            return slot < activeCount ? regions[order[slot]].getWeight() : W{0};
+        });
+        treeUpdatesSinceBuild = 0;
+    }
+};
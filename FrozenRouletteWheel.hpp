@@ -0,0 +1,236 @@
+#pragma once
+
+#include "classes/WheelRandom.hpp"
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+/**
+ * @brief An immutable roulette wheel whose selection table is built at compile time.
+ *
+ * Intended for hardcoded tables (weather, rarity tiers, ...). When declared constexpr,
+ * the total weight and a Vose alias table are computed by the compiler and the whole
+ * wheel lives in read-only data, so a selection is one random draw and one table lookup.
+ * Construction rejects non-positive weights; in a constant expression that rejection is
+ * a compile error.
+ *
+ * Integral weights use an exact integer alias table (the total weight times N must fit
+ * in unsigned long long); floating-point weights use a double alias table.
+ *
+ * @tparam E Element type to store (must be a literal type to build the wheel at compile time)
+ * @tparam W Weight type (must be numeric: int, float, double, etc.)
+ * @tparam N Number of regions
+ */
+template<typename E, typename W, size_t N>
+class FrozenRouletteWheel {
+public:
+    static_assert(N > 0, "FrozenRouletteWheel: a frozen wheel needs at least one region");
+
+    /// Type of the alias table thresholds (exact integers for integral weights)
+    using Threshold = std::conditional_t<std::is_integral_v<W>, unsigned long long, double>;
+
+    /*** Constructors ***/
+
+    /**
+     * @brief Builds the wheel and its alias table from element-weight pairs
+     * @param entries The (element, weight) pairs, in region order
+     * @throws std::invalid_argument if a weight is negative or zero
+     */
+    constexpr explicit FrozenRouletteWheel(const std::array<std::pair<E, W>, N>& entries) {
+        for (size_t i = 0; i < N; ++i) {
+            if (entries[i].second <= W{0}) {
+                throw std::invalid_argument("FrozenRouletteWheel: weights must be positive");
+            }
+            elements[i] = entries[i].first;
+            weights[i] = entries[i].second;
+            totalWeight += entries[i].second;
+        }
+        buildAliasTable();
+    }
+
+    /*** Selection Methods ***/
+
+    /**
+     * @brief Selects an element using the precomputed alias table
+     * @return Reference to the selected element inside the wheel
+     */
+    const E& select() const {
+        return elements[selectIndex()];
+    }
+
+    /**
+     * @brief Selects a region index using the precomputed alias table
+     * @return Index of the selected region
+     */
+    size_t selectIndex() const {
+        // A single draw over [0, N * columnMass) picks both the column and the offset within it
+        const Threshold columnMass = static_cast<Threshold>(totalWeight);
+        size_t column = 0;
+        Threshold randomValue{};
+        if constexpr (std::is_integral_v<W>) {
+            const Threshold draw = WheelRandom::weightBelow(columnMass * static_cast<Threshold>(N));
+            column = static_cast<size_t>(draw / columnMass);
+            randomValue = draw % columnMass;
+        } else {
+            const double draw = WheelRandom::weightBelow(static_cast<double>(N));
+            column = std::min(static_cast<size_t>(draw), N - 1);
+            randomValue = (draw - static_cast<double>(column)) * columnMass;
+        }
+        return randomValue < thresholds[column] ? column : aliases[column];
+    }
+
+    /*** Query Methods ***/
+
+    /**
+     * @brief Gets the number of regions in the wheel
+     * @return N
+     */
+    static constexpr size_t size() {
+        return N;
+    }
+
+    /**
+     * @brief Gets the sum of all region weights
+     * @return Total weight
+     */
+    constexpr W getTotalWeight() const {
+        return totalWeight;
+    }
+
+    /**
+     * @brief Gets the element of a region
+     * @param index Region index
+     * @return Reference to the element
+     */
+    constexpr const E& getElement(size_t index) const {
+        return elements[index];
+    }
+
+    /**
+     * @brief Gets the weight of a region
+     * @param index Region index
+     * @return The region's weight
+     */
+    constexpr W getWeight(size_t index) const {
+        return weights[index];
+    }
+
+    /**
+     * @brief Gets the alias table threshold of a column
+     * @param index Column index
+     * @return Values below this keep the column's own region; the rest go to its alias
+     */
+    constexpr Threshold getThreshold(size_t index) const {
+        return thresholds[index];
+    }
+
+    /**
+     * @brief Gets the alias of a column
+     * @param index Column index
+     * @return Region chosen when a draw in this column exceeds its threshold
+     */
+    constexpr size_t getAlias(size_t index) const {
+        return aliases[index];
+    }
+
+    /**
+     * @brief Calculates the selection probability for an element as a fraction
+     * @param element The element to query (probabilities of equal entries are summed)
+     * @return Probability fraction (0.0 to 1.0), or 0.0 if element not found
+     */
+    constexpr double getSelectionProbability(const E& element) const {
+        W elementWeight = W{0};
+        for (size_t i = 0; i < N; ++i) {
+            if (elements[i] == element) {
+                elementWeight += weights[i];
+            }
+        }
+        return static_cast<double>(elementWeight) / static_cast<double>(totalWeight);
+    }
+
+private:
+    /*** Member Variables ***/
+    std::array<E, N> elements{};
+    std::array<W, N> weights{};
+    W totalWeight = W{0};
+    std::array<Threshold, N> thresholds{};
+    std::array<size_t, N> aliases{};
+
+    /*** Private Helper Methods ***/
+
+    /**
+     * @brief Builds the alias table with Vose's method.
+     *
+     * Every column holds totalWeight units of probability mass. Each region starts with
+     * weight * N units; under-full columns are topped up from over-full ones.
+     */
+    constexpr void buildAliasTable() {
+        const Threshold columnMass = static_cast<Threshold>(totalWeight);
+        std::array<Threshold, N> scaled{};
+        std::array<size_t, N> small{};
+        std::array<size_t, N> large{};
+        size_t smallCount = 0;
+        size_t largeCount = 0;
+
+        for (size_t i = 0; i < N; ++i) {
+            scaled[i] = static_cast<Threshold>(weights[i]) * static_cast<Threshold>(N);
+            aliases[i] = i;
+            if (scaled[i] < columnMass) {
+                small[smallCount++] = i;
+            } else {
+                large[largeCount++] = i;
+            }
+        }
+
+        while (smallCount > 0 && largeCount > 0) {
+            const size_t under = small[--smallCount];
+            const size_t over = large[--largeCount];
+            thresholds[under] = scaled[under];
+            aliases[under] = over;
+            scaled[over] = scaled[over] - (columnMass - scaled[under]);
+            if (scaled[over] < columnMass) {
+                small[smallCount++] = over;
+            } else {
+                large[largeCount++] = over;
+            }
+        }
+
+        // Whatever remains is full up to rounding error
+        while (largeCount > 0) {
+            thresholds[large[--largeCount]] = columnMass;
+        }
+        while (smallCount > 0) {
+            thresholds[small[--smallCount]] = columnMass;
+        }
+    }
+};
+
+/**
+ * @brief Implementation of makeFrozenRouletteWheel (std::pair assignment is not constexpr
+ *        in C++17, so the array is built by pack expansion instead of a loop)
+ */
+template<typename E, typename W, size_t N, size_t... I>
+constexpr FrozenRouletteWheel<E, W, N> makeFrozenRouletteWheel(const std::pair<E, W> (&entries)[N],
+                                                               std::index_sequence<I...>) {
+    return FrozenRouletteWheel<E, W, N>(std::array<std::pair<E, W>, N>{{entries[I]...}});
+}
+
+/**
+ * @brief Builds a FrozenRouletteWheel from a braced list of element-weight pairs
+ *
+ * @code
+ * constexpr auto weather = makeFrozenRouletteWheel<std::string_view, int>({
+ *     {"Sunny", 50}, {"Cloudy", 30}, {"Rainy", 15}, {"Stormy", 5}
+ * });
+ * @endcode
+ *
+ * @param entries The (element, weight) pairs
+ * @return The frozen wheel
+ */
+template<typename E, typename W, size_t N>
+constexpr FrozenRouletteWheel<E, W, N> makeFrozenRouletteWheel(const std::pair<E, W> (&entries)[N]) {
+    return makeFrozenRouletteWheel(entries, std::make_index_sequence<N>{});
+}
@@ -0,0 +1,279 @@
+#pragma once
+
+#include "classes/AliasTable.hpp"
+#include "classes/MappedFile.hpp"
+#include "classes/WheelRandom.hpp"
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <ostream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+/**
+ * @brief A frozen wheel read in place from a binary image (e.g. a memory-mapped file).
+ *
+ * The image holds everything a draw needs: a header, the region weights, a Vose alias table
+ * and one 32-bit element id per region (e.g. an index into a WheelCatalog or an item table).
+ * Every section is addressed by its offset from the start of the image and is 8-byte aligned,
+ * so an image can be mapped anywhere and selected from directly. Opening a view checks the
+ * header in O(1); nothing is parsed, copied or allocated.
+ *
+ * Images use the writer's native byte order and IEEE doubles; a byte-order mark in the header
+ * rejects images from a machine that differs. Section contents are not scanned on load, so
+ * only open images from trusted sources.
+ *
+ * Layout (format version 1):
+ * | Section       | Type              | Count |
+ * |---------------|-------------------|-------|
+ * | Header        | FrozenWheelHeader | 1     |
+ * | Weights       | double            | count |
+ * | Probabilities | double            | count |
+ * | Aliases       | uint32_t          | count |
+ * | Element ids   | uint32_t          | count |
+ */
+class FrozenWheelView {
+public:
+    /// Current image format version
+    static constexpr std::uint32_t formatVersion = 1;
+
+    /**
+     * @brief Fixed-size header at the start of every image
+     */
+    struct FrozenWheelHeader {
+        char magic[8];                ///< "RWFROZEN"
+        std::uint32_t version;        ///< formatVersion of the writer
+        std::uint32_t byteOrderMark;  ///< byteOrderMark as written by the writer
+        std::uint64_t count;          ///< Number of regions
+        std::uint64_t imageSize;      ///< Size of the whole image in bytes
+        double totalWeight;           ///< Sum of the weights
+        std::uint64_t weightsOffset;
+        std::uint64_t probabilitiesOffset;
+        std::uint64_t aliasesOffset;
+        std::uint64_t elementIdsOffset;
+    };
+    static_assert(sizeof(FrozenWheelHeader) % 8 == 0 && std::is_trivially_copyable_v<FrozenWheelHeader>,
+                  "FrozenWheelView: the header must be a plain, 8-byte padded struct");
+
+    /*** Writing ***/
+
+    /**
+     * @brief Writes a wheel image (weights, alias table and element ids) to a stream
+     * @param out Stream to write to (open it in binary mode)
+     * @param idWeightPairs The wheel's (element id, weight) tuples, in region order
+     * @throws std::invalid_argument if the list is empty or a weight is not positive and finite
+     * @throws std::runtime_error if the stream fails
+     */
+    template<typename W>
+    static void write(std::ostream& out, const std::vector<std::tuple<std::uint32_t, W>>& idWeightPairs) {
+        const size_t count = idWeightPairs.size();
+        if (count == 0 || count > UINT32_MAX) {
+            throw std::invalid_argument("FrozenWheelView::write: a wheel needs 1 to 2^32 - 1 regions");
+        }
+
+        std::vector<double> weights(count);
+        std::vector<std::uint32_t> elementIds(count);
+        double totalWeight = 0.0;
+        for (size_t i = 0; i < count; ++i) {
+            weights[i] = static_cast<double>(std::get<1>(idWeightPairs[i]));
+            elementIds[i] = std::get<0>(idWeightPairs[i]);
+            if (!(weights[i] > 0.0) || !std::isfinite(weights[i])) {
+                std::ostringstream msg;
+                msg << "FrozenWheelView::write: weight must be positive and finite, got " << weights[i];
+                throw std::invalid_argument(msg.str());
+            }
+            totalWeight += weights[i];
+        }
+        AliasTable<> aliasTable;
+        aliasTable.build(count, [&weights](size_t i) { return weights[i]; }, totalWeight);
+
+        FrozenWheelHeader header{};
+        std::memcpy(header.magic, magic, sizeof(header.magic));
+        header.version = formatVersion;
+        header.byteOrderMark = byteOrderMark;
+        header.count = count;
+        header.totalWeight = totalWeight;
+        header.weightsOffset = sizeof(FrozenWheelHeader);
+        header.probabilitiesOffset = header.weightsOffset + alignedSize(count * sizeof(double));
+        header.aliasesOffset = header.probabilitiesOffset + alignedSize(count * sizeof(double));
+        header.elementIdsOffset = header.aliasesOffset + alignedSize(count * sizeof(std::uint32_t));
+        header.imageSize = header.elementIdsOffset + alignedSize(count * sizeof(std::uint32_t));
+
+        writeBytes(out, &header, sizeof(header));
+        writeSection(out, weights.data(), count * sizeof(double));
+        writeSection(out, aliasTable.probabilityData(), count * sizeof(double));
+        writeSection(out, aliasTable.aliasData(), count * sizeof(std::uint32_t));
+        writeSection(out, elementIds.data(), count * sizeof(std::uint32_t));
+        if (!out) {
+            throw std::runtime_error("FrozenWheelView::write: failed to write the image");
+        }
+    }
+
+    /*** Constructors ***/
+
+    /**
+     * @brief Opens a view over an image in memory (the image must outlive the view)
+     * @param image Start of the image (must be 8-byte aligned, as mapped files are)
+     * @param size Number of bytes available at image
+     * @throws std::runtime_error if the image is truncated, misaligned, from another byte
+     *         order or format version, or its sections are out of bounds
+     */
+    FrozenWheelView(const void* image, size_t size)
+        : base(static_cast<const unsigned char*>(image)) {
+        if (image == nullptr || reinterpret_cast<std::uintptr_t>(image) % alignof(double) != 0) {
+            throw std::runtime_error("FrozenWheelView: image must be non-null and 8-byte aligned");
+        }
+        if (size < sizeof(FrozenWheelHeader)) {
+            throw std::runtime_error("FrozenWheelView: image is smaller than its header");
+        }
+
+        const FrozenWheelHeader& header = *reinterpret_cast<const FrozenWheelHeader*>(base);
+        if (std::memcmp(header.magic, magic, sizeof(header.magic)) != 0) {
+            throw std::runtime_error("FrozenWheelView: not a frozen wheel image");
+        }
+        if (header.byteOrderMark != byteOrderMark) {
+            throw std::runtime_error("FrozenWheelView: image was written with a different byte order");
+        }
+        if (header.version != formatVersion) {
+            std::ostringstream msg;
+            msg << "FrozenWheelView: unsupported format version " << header.version;
+            throw std::runtime_error(msg.str());
+        }
+
+        const std::uint64_t count = header.count;
+        if (count == 0 || count > UINT32_MAX || header.imageSize > size
+            || !sectionFits(header.weightsOffset, count * sizeof(double), header.imageSize)
+            || !sectionFits(header.probabilitiesOffset, count * sizeof(double), header.imageSize)
+            || !sectionFits(header.aliasesOffset, count * sizeof(std::uint32_t), header.imageSize)
+            || !sectionFits(header.elementIdsOffset, count * sizeof(std::uint32_t), header.imageSize)) {
+            throw std::runtime_error("FrozenWheelView: image is truncated or its sections are out of bounds");
+        }
+
+        regionCount = static_cast<size_t>(count);
+        totalWeight = header.totalWeight;
+        weights = reinterpret_cast<const double*>(base + header.weightsOffset);
+        probabilities = reinterpret_cast<const double*>(base + header.probabilitiesOffset);
+        aliases = reinterpret_cast<const std::uint32_t*>(base + header.aliasesOffset);
+        elementIds = reinterpret_cast<const std::uint32_t*>(base + header.elementIdsOffset);
+    }
+
+    /**
+     * @brief Opens a view over a mapped file (the mapping must outlive the view)
+     * @param file The mapped image
+     * @throws std::runtime_error if the file is not a valid image
+     */
+    explicit FrozenWheelView(const MappedFile& file)
+        : FrozenWheelView(file.data(), file.size()) {
+    }
+
+    /*** Selection Methods ***/
+
+    /**
+     * @brief Selects an element id using the stored alias table in O(1)
+     * @return The selected region's element id
+     */
+    std::uint32_t select() const {
+        return elementIds[selectIndex()];
+    }
+
+    /**
+     * @brief Selects a region index using the stored alias table in O(1)
+     * @return Index of the selected region
+     */
+    size_t selectIndex() const {
+        return AliasTable<>::sample(probabilities, aliases, regionCount);
+    }
+
+    /*** Query Methods ***/
+
+    /**
+     * @brief Gets the number of regions in the wheel
+     * @return Number of regions
+     */
+    size_t size() const {
+        return regionCount;
+    }
+
+    /**
+     * @brief Gets the sum of all region weights
+     * @return Total weight
+     */
+    double getTotalWeight() const {
+        return totalWeight;
+    }
+
+    /**
+     * @brief Gets the element id of a region
+     * @param index Region index (must be less than size())
+     * @return The element id
+     */
+    std::uint32_t getElementId(size_t index) const {
+        return elementIds[index];
+    }
+
+    /**
+     * @brief Gets the weight of a region
+     * @param index Region index (must be less than size())
+     * @return The weight
+     */
+    double getWeight(size_t index) const {
+        return weights[index];
+    }
+
+    /**
+     * @brief Calculates the selection probability of a region
+     * @param index Region index (must be less than size())
+     * @return Probability fraction (0.0 to 1.0)
+     */
+    double getSelectionProbability(size_t index) const {
+        return weights[index] / totalWeight;
+    }
+
+    /**
+     * @brief Seeds the shared random number generator for the current thread.
+     * @param seed The seed value
+     * @note The engine is shared by all wheels on the calling thread.
+     */
+    void seedRandom(unsigned int seed) {
+        WheelRandom::seed(seed);
+    }
+
+private:
+    static constexpr char magic[8] = {'R', 'W', 'F', 'R', 'O', 'Z', 'E', 'N'};
+    static constexpr std::uint32_t byteOrderMark = 0x01020304;
+
+    /*** Member Variables ***/
+    const unsigned char* base;
+    size_t regionCount = 0;
+    double totalWeight = 0.0;
+    const double* weights = nullptr;
+    const double* probabilities = nullptr;
+    const std::uint32_t* aliases = nullptr;
+    const std::uint32_t* elementIds = nullptr;
+
+    /*** Private Helper Methods ***/
+
+    static constexpr size_t alignedSize(size_t bytes) {
+        return (bytes + 7) / 8 * 8;
+    }
+
+    static bool sectionFits(std::uint64_t offset, std::uint64_t bytes, std::uint64_t imageSize) {
+        return offset % 8 == 0 && offset >= sizeof(FrozenWheelHeader)
+            && offset <= imageSize && bytes <= imageSize - offset;
+    }
+
+    static void writeBytes(std::ostream& out, const void* data, size_t bytes) {
+        out.write(static_cast<const char*>(data), static_cast<std::streamsize>(bytes));
+    }
+
+    static void writeSection(std::ostream& out, const void* data, size_t bytes) {
+        static constexpr char padding[8] = {};
+        writeBytes(out, data, bytes);
+        writeBytes(out, padding, alignedSize(bytes) - bytes);
+    }
+};
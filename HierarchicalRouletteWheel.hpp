@@ -0,0 +1,531 @@
+#pragma once
+
+#include "classes/ElementIndex.hpp"
+#include "classes/FenwickTree.hpp"
+#include "classes/WheelRandom.hpp"
+#include <cstddef>
+#include <optional>
+#include <sstream>
+#include <stdexcept>
+#include <vector>
+
+/**
+ * @brief A roulette wheel whose regions can be nested tiers ("pick a rarity, then an item").
+ *
+ * Tiers form a tree rooted at HierarchicalRouletteWheel::root. Selection descends from the
+ * root, choosing among each tier's children by weight until it reaches an element. A tier's
+ * weight in its parent is either fixed (set with addTier(parent, weight) or setTierWeight)
+ * and independent of what the tier holds, or follows the sum of its contents (addTier(parent)).
+ * Changes to an element or tier weight propagate up through content-following tiers and stop
+ * at the first fixed-weight tier, so retuning a tier is O(log k) regardless of its size.
+ *
+ * Every tier keeps a Fenwick tree over its children, making each level of a draw O(log k)
+ * for a tier with k children. Tiers with no elements beneath them are never selected.
+ * Each tier also indexes its elements (see ElementIndex), so finding an element to add to,
+ * reweight or remove stays O(1) however wide the tier grows.
+ *
+ * @tparam E Element type to store
+ * @tparam W Weight type (must be numeric: int, float, double, etc.)
+ */
+template<typename E, typename W>
+class HierarchicalRouletteWheel {
+public:
+    /// Identifies a tier within the wheel
+    using TierId = size_t;
+
+    /// The top-level tier every wheel starts with
+    static constexpr TierId root = 0;
+
+    /*** Constructors ***/
+
+    /**
+     * @brief Default constructor - creates a wheel holding only the empty root tier
+     */
+    HierarchicalRouletteWheel()
+        : tiers(1) {
+    }
+
+    /*** Selection Methods ***/
+
+    /**
+     * @brief Selects an element by descending the tiers by weight
+     * @return The selected element
+     * @throws std::runtime_error if no tier holds any element
+     */
+    E select() const {
+        return elements[selectLeaf()].element;
+    }
+
+    /**
+     * @brief Selects an element and returns it as an optional (safe version)
+     * @return Optional containing the selected element, or nullopt if the wheel holds no elements
+     */
+    std::optional<E> selectSafe() const {
+        if (empty()) {
+            return std::nullopt;
+        }
+        return select();
+    }
+
+    /*** Modification Methods ***/
+
+    /**
+     * @brief Adds a tier whose weight follows the total weight of its contents
+     * @param parent The tier to nest the new tier in
+     * @return Id of the new tier
+     * @throws std::out_of_range if parent is not a tier of this wheel
+     */
+    TierId addTier(TierId parent) {
+        checkTier(parent, "addTier");
+        return appendTier(parent, std::nullopt);
+    }
+
+    /**
+     * @brief Adds a tier with a fixed weight, independent of its contents
+     * @param parent The tier to nest the new tier in
+     * @param weight The tier's weight within its parent (must be positive)
+     * @return Id of the new tier
+     * @throws std::out_of_range if parent is not a tier of this wheel
+     * @throws std::invalid_argument if weight is negative or zero
+     */
+    TierId addTier(TierId parent, W weight) {
+        checkTier(parent, "addTier");
+        validateWeight(weight, "addTier");
+        return appendTier(parent, weight);
+    }
+
+    /**
+     * @brief Adds an element to a tier, or combines weight if the tier already holds it
+     * @param tier The tier to add to
+     * @param element The element to add
+     * @param weight The weight for this element (must be positive)
+     * @throws std::out_of_range if tier is not a tier of this wheel
+     * @throws std::invalid_argument if weight is negative or zero
+     */
+    void addElement(TierId tier, const E& element, W weight) {
+        checkTier(tier, "addElement");
+        validateWeight(weight, "addElement");
+
+        const auto existingLeaf = findLeaf(tier, element);
+        if (existingLeaf.has_value()) {
+            setLeafWeight(*existingLeaf, elements[*existingLeaf].weight + weight);
+            return;
+        }
+
+        Tier& owner = tiers[tier];
+        elements.push_back(Leaf{element, weight, tier, owner.children.size(), owner.leaves.size()});
+        owner.children.push_back(Child{false, elements.size() - 1});
+        owner.childWeights.pushBack(weight);
+        owner.leaves.push_back(elements.size() - 1);
+        owner.leafIndex.onAppend(element, owner.leaves.size() - 1);
+        countElements(tier, 1);
+        propagate(tier);
+    }
+
+    /**
+     * @brief Sets the weight of an element within its tier
+     * @param tier The tier holding the element
+     * @param element The element
+     * @param weight The new weight (must be positive)
+     * @return true if the element was found, false otherwise
+     * @throws std::out_of_range if tier is not a tier of this wheel
+     * @throws std::invalid_argument if weight is negative or zero
+     */
+    bool setElementWeight(TierId tier, const E& element, W weight) {
+        checkTier(tier, "setElementWeight");
+        validateWeight(weight, "setElementWeight");
+
+        const auto leaf = findLeaf(tier, element);
+        if (!leaf.has_value()) {
+            return false;
+        }
+        setLeafWeight(*leaf, weight);
+        return true;
+    }
+
+    /**
+     * @brief Removes an element from a tier
+     * @param tier The tier holding the element
+     * @param element The element to remove
+     * @return true if the element was found and removed, false otherwise
+     * @throws std::out_of_range if tier is not a tier of this wheel
+     */
+    bool removeElement(TierId tier, const E& element) {
+        checkTier(tier, "removeElement");
+
+        const auto leaf = findLeaf(tier, element);
+        if (!leaf.has_value()) {
+            return false;
+        }
+
+        removeChild(tier, elements[*leaf].slot);
+        removeFromLeaves(tier, elements[*leaf].position);
+        removeLeafRecord(*leaf);
+        countElements(tier, -1);
+        propagate(tier);
+        return true;
+    }
+
+    /**
+     * @brief Fixes a tier's weight within its parent, independent of its contents
+     * @param tier The tier to retune (not the root)
+     * @param weight The new weight (must be positive)
+     * @throws std::out_of_range if tier is not a non-root tier of this wheel
+     * @throws std::invalid_argument if weight is negative or zero
+     */
+    void setTierWeight(TierId tier, W weight) {
+        checkNestedTier(tier, "setTierWeight");
+        validateWeight(weight, "setTierWeight");
+
+        tiers[tier].fixedWeight = weight;
+        propagate(tier);
+    }
+
+    /**
+     * @brief Makes a tier's weight follow the total weight of its contents again
+     * @param tier The tier (not the root)
+     * @throws std::out_of_range if tier is not a non-root tier of this wheel
+     */
+    void followTierContents(TierId tier) {
+        checkNestedTier(tier, "followTierContents");
+
+        tiers[tier].fixedWeight.reset();
+        propagate(tier);
+    }
+
+    /*** Query Methods ***/
+
+    /**
+     * @brief Checks if the wheel holds no elements
+     * @return true if empty, false otherwise
+     */
+    bool empty() const {
+        return elements.empty();
+    }
+
+    /**
+     * @brief Gets the number of elements across all tiers
+     * @return Number of elements
+     */
+    size_t size() const {
+        return elements.size();
+    }
+
+    /**
+     * @brief Gets the number of tiers, including the root
+     * @return Number of tiers
+     */
+    size_t tierCount() const {
+        return tiers.size();
+    }
+
+    /**
+     * @brief Gets the weight a tier currently carries in its parent
+     * @param tier The tier
+     * @return The fixed weight, the contents' total for content-following tiers, or 0 for a
+     *         tier with no weighted contents
+     * @throws std::out_of_range if tier is not a tier of this wheel
+     */
+    W getTierWeight(TierId tier) const {
+        checkTier(tier, "getTierWeight");
+        return effectiveWeight(tier);
+    }
+
+    /**
+     * @brief Gets the total weight of a tier's direct children
+     * @param tier The tier
+     * @return Sum of the children's weights
+     * @throws std::out_of_range if tier is not a tier of this wheel
+     */
+    W getTierTotal(TierId tier) const {
+        checkTier(tier, "getTierTotal");
+        return tiers[tier].childWeights.getTotal();
+    }
+
+    /**
+     * @brief Calculates the probability that select() returns an element from a given tier
+     * @param tier The tier holding the element
+     * @param element The element to query
+     * @return Probability fraction (0.0 to 1.0), or 0.0 if the tier does not hold the element
+     * @throws std::out_of_range if tier is not a tier of this wheel
+     */
+    double getSelectionProbability(TierId tier, const E& element) const {
+        checkTier(tier, "getSelectionProbability");
+
+        const auto leaf = findLeaf(tier, element);
+        if (!leaf.has_value()) {
+            return 0.0;
+        }
+
+        double probability = static_cast<double>(elements[*leaf].weight)
+                           / static_cast<double>(tiers[tier].childWeights.getTotal());
+        for (TierId current = tier; current != root; current = tiers[current].parent) {
+            const TierId parent = tiers[current].parent;
+            probability *= static_cast<double>(tiers[current].weightInParent)
+                         / static_cast<double>(tiers[parent].childWeights.getTotal());
+        }
+        return probability;
+    }
+
+    /**
+     * @brief Seeds the shared random number generator for the current thread.
+     * @param seed The seed value
+     * @note The engine is shared by all wheels on the calling thread.
+     */
+    void seedRandom(unsigned int seed) {
+        WheelRandom::seed(seed);
+    }
+
+private:
+    /**
+     * @brief A child slot of a tier: either a nested tier or an element
+     */
+    struct Child {
+        bool isTier;
+        size_t index; ///< TierId, or index into elements
+    };
+
+    struct Leaf;
+
+    /**
+     * @brief The elements of one tier, in the shape ElementIndex looks them up in
+     */
+    struct TierLeaves {
+        const std::vector<size_t>& leaves;
+        const std::vector<Leaf>& elements;
+
+        size_t size() const {
+            return leaves.size();
+        }
+
+        const Leaf& operator[](size_t position) const {
+            return elements[leaves[position]];
+        }
+    };
+
+    struct Tier {
+        std::vector<Child> children;
+        std::vector<size_t> leaves;        ///< Indices into elements of the element children
+        ElementIndex<E> leafIndex;         ///< Maps each element to its position in leaves
+        FenwickTree<W> childWeights;       ///< Weight of each child slot, in slot order
+        std::optional<W> fixedWeight;      ///< Weight in the parent; nullopt follows the contents
+        W weightInParent = W{0};           ///< Weight currently stored in the parent's childWeights
+        size_t elementCount = 0;           ///< Elements in this tier and all tiers beneath it
+        TierId parent = root;
+        size_t slot = 0;                   ///< Position among the parent's children
+    };
+
+    struct Leaf {
+        E element;
+        W weight;
+        TierId tier;
+        size_t slot;                       ///< Position among the tier's children
+        size_t position;                   ///< Position in the tier's leaves
+
+        const E& getElement() const {
+            return element;
+        }
+    };
+
+    /*** Member Variables ***/
+    std::vector<Tier> tiers;
+    std::vector<Leaf> elements;
+
+    /*** Private Helper Methods ***/
+
+    /**
+     * @brief Descends from the root to an element
+     * @return Index into elements of the selected element
+     * @throws std::runtime_error if no tier holds any element
+     */
+    size_t selectLeaf() const {
+        if (empty()) {
+            throw std::runtime_error("HierarchicalRouletteWheel::select: wheel holds no elements");
+        }
+
+        TierId tier = root;
+        for (;;) {
+            const FenwickTree<W>& weights = tiers[tier].childWeights;
+            const size_t slot = weights.find(WheelRandom::weightBelow(weights.getTotal()));
+            const Child& child = tiers[tier].children[slot];
+            if (!child.isTier) {
+                return child.index;
+            }
+            // Floating-point residue can leave an emptied tier a sliver of weight; draw again
+            if (tiers[child.index].elementCount > 0) {
+                tier = child.index;
+            }
+        }
+    }
+
+    /**
+     * @brief Gets the weight a tier carries in its parent
+     * @param tier The tier
+     * @return The fixed weight or the contents' total; 0 while the tier holds nothing
+     */
+    W effectiveWeight(TierId tier) const {
+        if (tiers[tier].elementCount == 0) {
+            return W{0};
+        }
+        return tiers[tier].fixedWeight.value_or(tiers[tier].childWeights.getTotal());
+    }
+
+    /**
+     * @brief Pushes a change in a tier's effective weight up to its ancestors, stopping at the
+     *        first ancestor whose own weight in its parent does not change
+     * @param tier The tier whose contents or fixed weight changed
+     */
+    void propagate(TierId tier) {
+        while (tier != root) {
+            Tier& current = tiers[tier];
+            const W newWeight = effectiveWeight(tier);
+            if (newWeight == current.weightInParent) {
+                return;
+            }
+            tiers[current.parent].childWeights.add(current.slot, newWeight - current.weightInParent);
+            current.weightInParent = newWeight;
+            tier = current.parent;
+        }
+    }
+
+    /**
+     * @brief Adjusts the element count of a tier and all of its ancestors
+     * @param tier The tier an element was added to or removed from
+     * @param delta +1 or -1
+     */
+    void countElements(TierId tier, int delta) {
+        for (;;) {
+            tiers[tier].elementCount += delta;
+            if (tier == root) {
+                return;
+            }
+            tier = tiers[tier].parent;
+        }
+    }
+
+    TierId appendTier(TierId parent, std::optional<W> fixedWeight) {
+        Tier tier;
+        tier.fixedWeight = fixedWeight;
+        tier.parent = parent;
+        tier.slot = tiers[parent].children.size();
+        tiers.push_back(std::move(tier));
+
+        // A new tier is empty, so it carries no weight until elements are added beneath it
+        tiers[parent].children.push_back(Child{true, tiers.size() - 1});
+        tiers[parent].childWeights.pushBack(W{0});
+        return tiers.size() - 1;
+    }
+
+    void setLeafWeight(size_t leaf, W weight) {
+        const TierId tier = elements[leaf].tier;
+        tiers[tier].childWeights.add(elements[leaf].slot, weight - elements[leaf].weight);
+        elements[leaf].weight = weight;
+        propagate(tier);
+    }
+
+    /**
+     * @brief Removes a child slot from a tier by moving its last child into the gap
+     * @param tier The tier
+     * @param slot The slot to remove
+     */
+    void removeChild(TierId tier, size_t slot) {
+        Tier& owner = tiers[tier];
+        const size_t lastSlot = owner.children.size() - 1;
+        const W removedWeight = childWeight(owner.children[slot]);
+        const W lastWeight = childWeight(owner.children[lastSlot]);
+
+        if (slot != lastSlot) {
+            owner.childWeights.add(slot, lastWeight - removedWeight);
+            owner.children[slot] = owner.children[lastSlot];
+            setChildSlot(owner.children[slot], slot);
+        }
+        owner.childWeights.popBack(slot != lastSlot ? lastWeight : removedWeight);
+        owner.children.pop_back();
+    }
+
+    /**
+     * @brief Removes an element from its tier's leaves by moving the tier's last leaf into the gap
+     * @param tier The tier
+     * @param position The element's position in the tier's leaves
+     */
+    void removeFromLeaves(TierId tier, size_t position) {
+        Tier& owner = tiers[tier];
+        const size_t lastPosition = owner.leaves.size() - 1;
+        const E& removed = elements[owner.leaves[position]].element;
+        if (position != lastPosition) {
+            owner.leafIndex.onSwapErase(removed, elements[owner.leaves[lastPosition]].element, position, lastPosition);
+            owner.leaves[position] = owner.leaves[lastPosition];
+            elements[owner.leaves[position]].position = position;
+        } else {
+            owner.leafIndex.onErase(removed, position, owner.leaves.size());
+        }
+        owner.leaves.pop_back();
+    }
+
+    /**
+     * @brief Removes an element record by moving the last record into its place
+     * @param leaf Index into elements of the record to remove
+     */
+    void removeLeafRecord(size_t leaf) {
+        const size_t lastLeaf = elements.size() - 1;
+        if (leaf != lastLeaf) {
+            elements[leaf] = std::move(elements[lastLeaf]);
+            Tier& owner = tiers[elements[leaf].tier];
+            owner.children[elements[leaf].slot].index = leaf;
+            owner.leaves[elements[leaf].position] = leaf;
+        }
+        elements.pop_back();
+    }
+
+    W childWeight(const Child& child) const {
+        return child.isTier ? tiers[child.index].weightInParent : elements[child.index].weight;
+    }
+
+    void setChildSlot(const Child& child, size_t slot) {
+        if (child.isTier) {
+            tiers[child.index].slot = slot;
+        } else {
+            elements[child.index].slot = slot;
+        }
+    }
+
+    /**
+     * @brief Finds an element among a tier's direct children
+     * @param tier The tier
+     * @param element The element to find
+     * @return Optional containing the index into elements, or nullopt if not found
+     */
+    std::optional<size_t> findLeaf(TierId tier, const E& element) const {
+        const Tier& owner = tiers[tier];
+        const auto position = owner.leafIndex.find(element, TierLeaves{owner.leaves, elements}, owner.leaves.size());
+        if (!position.has_value()) {
+            return std::nullopt;
+        }
+        return owner.leaves[*position];
+    }
+
+    void checkTier(TierId tier, const char* caller) const {
+        if (tier >= tiers.size()) {
+            std::ostringstream msg;
+            msg << "HierarchicalRouletteWheel::" << caller << ": unknown tier " << tier;
+            throw std::out_of_range(msg.str());
+        }
+    }
+
+    void checkNestedTier(TierId tier, const char* caller) const {
+        checkTier(tier, caller);
+        if (tier == root) {
+            std::ostringstream msg;
+            msg << "HierarchicalRouletteWheel::" << caller << ": the root tier has no weight";
+            throw std::out_of_range(msg.str());
+        }
+    }
+
+    static void validateWeight(W weight, const char* caller) {
+        if (weight <= 0) {
+            std::ostringstream msg;
+            msg << "HierarchicalRouletteWheel::" << caller << ": weight must be positive, got " << weight;
+            throw std::invalid_argument(msg.str());
+        }
+    }
+};
@@ -0,0 +1,510 @@
+#pragma once
+
+#include "classes/ElementIndex.hpp"
+#include "classes/FenwickTree.hpp"
+#include "classes/WheelRandom.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <optional>
+#include <sstream>
+#include <stdexcept>
+#include <vector>
+
+/**
+ * @brief A roulette wheel whose regions are weighted by log-weights (logits).
+ *
+ * Each region's selection probability is softmax(logWeight / temperature), so log-probabilities
+ * from a policy can be used directly, including ones far too negative to exponentiate.
+ *
+ * Weights are stored as exp(logWeight / temperature - shift), where the shift is the largest
+ * scaled log-weight seen at the last rebuild. Every stored value is then at most
+ * exp(maximumExponent), and the log-sum-exp normaliser is cached as shift + log(total) in O(1).
+ * Stored values live in a Fenwick tree, so selection and single-region edits are O(log n) and
+ * cost one exp. An edit that would overflow the stored range, or that removes most of the
+ * stored weight, rebuilds the tree around a new shift in O(n).
+ *
+ * Log-weights and stored weights are kept in separate contiguous arrays, so whole-policy
+ * updates (setLogWeights) and rebuilds run as plain loops the compiler can vectorise.
+ *
+ * @tparam E Element type to store
+ */
+template<typename E>
+class LogitRouletteWheel {
+public:
+    /*** Constructors ***/
+
+    /**
+     * @brief Creates an empty wheel
+     * @param temperature Softmax temperature; values above 1 flatten the distribution and
+     *        values below 1 sharpen it
+     * @throws std::invalid_argument if temperature is not positive and finite
+     */
+    explicit LogitRouletteWheel(double temperature = 1.0) {
+        setTemperature(temperature);
+    }
+
+    /*** Selection Methods ***/
+
+    /**
+     * @brief Selects an element with probability softmax(logWeight / temperature) in O(log n)
+     * @return The selected element
+     * @throws std::runtime_error if the wheel is empty or every log-weight is -infinity
+     */
+    E select() const {
+        const double total = positiveTotal("select");
+        return regions[storedWeights.find(WheelRandom::weightBelow(total))].element;
+    }
+
+    /**
+     * @brief Selects an element and returns it as an optional (safe version)
+     * @return Optional containing the selected element, or nullopt if the wheel is empty
+     */
+    std::optional<E> selectSafe() const {
+        if (regions.empty()) {
+            return std::nullopt;
+        }
+        return select();
+    }
+
+    /**
+     * @brief Draws several elements independently (with replacement)
+     *
+     * Small batches descend the Fenwick tree once per draw (O(count log n)). Batches of at
+     * least n / sortedBatchDivisor draws instead bucket-sort their uniforms and walk the
+     * stored weights once, front to back (O(count + n)), which replaces scattered tree reads
+     * with one sequential pass. Either way the draws come out in the order they were
+     * made.
+     *
+     * @param count Number of draws
+     * @param out Output iterator receiving count elements
+     * @return The output iterator past the last written element
+     * @throws std::runtime_error if count is positive and the wheel has no selectable region
+     */
+    template<typename OutputIt>
+    OutputIt selectBatch(size_t count, OutputIt out) const {
+        if (count == 0) {
+            return out;
+        }
+        const double total = positiveTotal("selectBatch");
+        if (count < regions.size() / sortedBatchDivisor) {
+            for (size_t draw = 0; draw < count; ++draw) {
+                *out++ = regions[storedWeights.find(WheelRandom::weightBelow(total))].element;
+            }
+            return out;
+        }
+
+        // Counting-sort the draws into count equal-width buckets of [0, total); a bucket
+        // holds one draw on average, so ordering each bucket by target is nearly free
+        std::vector<double> targets(count);
+        std::vector<size_t> bucketStart(count + 1, 0);
+        const double bucketsPerWeight = static_cast<double>(count) / total;
+        const auto bucketOf = [&](double target) {
+            return std::min(static_cast<size_t>(target * bucketsPerWeight), count - 1);
+        };
+        for (size_t draw = 0; draw < count; ++draw) {
+            targets[draw] = WheelRandom::weightBelow(total);
+            ++bucketStart[bucketOf(targets[draw]) + 1];
+        }
+        for (size_t bucket = 0; bucket < count; ++bucket) {
+            bucketStart[bucket + 1] += bucketStart[bucket];
+        }
+        std::vector<size_t> order(count);
+        for (size_t draw = 0; draw < count; ++draw) {
+            order[bucketStart[bucketOf(targets[draw])]++] = draw;
+        }
+        // bucketStart[b] now holds the end of bucket b
+        const auto byTarget = [&](size_t left, size_t right) { return targets[left] < targets[right]; };
+        for (size_t bucket = 0, begin = 0; bucket < count; begin = bucketStart[bucket++]) {
+            if (bucketStart[bucket] - begin > 1) {
+                std::sort(order.begin() + begin, order.begin() + bucketStart[bucket], byTarget);
+            }
+        }
+
+        // One pass over the stored weights in target order
+        std::vector<size_t> picks(count);
+        size_t region = 0;
+        size_t lastSelectable = regions.size();
+        double cumulative = stored[0];
+        for (const size_t draw : order) {
+            const double target = targets[draw];
+            // The running sum can fall short of the tree's total by rounding; such targets
+            // belong to the last region with a positive weight
+            while (target >= cumulative && region + 1 < regions.size()) {
+                if (stored[region] > 0.0) {
+                    lastSelectable = region;
+                }
+                cumulative += stored[++region];
+            }
+            if (target < cumulative) {
+                picks[draw] = region;
+            } else {
+                picks[draw] = stored[region] > 0.0 ? region : lastSelectable;
+            }
+        }
+        for (size_t draw = 0; draw < count; ++draw) {
+            *out++ = regions[picks[draw]].element;
+        }
+        return out;
+    }
+
+    /**
+     * @brief Selects an element with the Gumbel-max trick in O(n)
+     *
+     * Adds independent Gumbel noise to every scaled log-weight and returns the argmax. It reads
+     * the log-weights directly, so it is exact at any magnitude and needs no normaliser; prefer
+     * it when the log-weights change before every draw.
+     *
+     * @return The selected element
+     * @throws std::runtime_error if the wheel is empty or every log-weight is -infinity
+     */
+    E selectGumbel() const {
+        if (regions.empty()) {
+            throw std::runtime_error("LogitRouletteWheel::selectGumbel: wheel is empty");
+        }
+
+        size_t best = regions.size();
+        double bestKey = -std::numeric_limits<double>::infinity();
+        for (size_t i = 0; i < logWeights.size(); ++i) {
+            const double uniform = 1.0 - WheelRandom::weightBelow(1.0); // (0, 1]
+            const double key = logWeights[i] * inverseTemperature - std::log(-std::log(uniform));
+            if (key > bestKey) {
+                bestKey = key;
+                best = i;
+            }
+        }
+        if (best == regions.size()) {
+            throw std::runtime_error("LogitRouletteWheel::selectGumbel: no region has a finite log-weight");
+        }
+        return regions[best].element;
+    }
+
+    /*** Modification Methods ***/
+
+    /**
+     * @brief Adds a region, or adds weight to an existing one (combined in log space)
+     * @param element The element
+     * @param logWeight Natural log of the weight to add
+     * @throws std::invalid_argument if logWeight is NaN or +infinity, or a new region's
+     *         logWeight is -infinity
+     */
+    void addRegion(const E& element, double logWeight) {
+        validateLogWeight(logWeight, "addRegion");
+
+        const auto index = elementIndex.find(element, regions, regions.size());
+        if (index.has_value()) {
+            writeLogWeight(*index, logAddExp(logWeights[*index], logWeight));
+            return;
+        }
+        if (logWeight == -std::numeric_limits<double>::infinity()) {
+            throw std::invalid_argument("LogitRouletteWheel::addRegion: a new region needs a finite log-weight");
+        }
+
+        regions.push_back(Region{element});
+        logWeights.push_back(logWeight);
+        const double scaled = logWeight * inverseTemperature;
+        if (scaled > shift + maximumExponent || lostStoredWeight()) {
+            stored.push_back(0.0);
+            rebuildStoredWeights();
+        } else {
+            stored.push_back(std::exp(scaled - shift));
+            storedWeights.pushBack(stored.back());
+        }
+        elementIndex.onAppend(element, regions.size() - 1);
+    }
+
+    /**
+     * @brief Replaces an element's log-weight
+     * @param element The element
+     * @param logWeight The new log-weight (-infinity makes the region unselectable)
+     * @return true if the element was found, false otherwise
+     * @throws std::invalid_argument if logWeight is NaN or +infinity
+     */
+    bool setLogWeight(const E& element, double logWeight) {
+        validateLogWeight(logWeight, "setLogWeight");
+
+        const auto index = elementIndex.find(element, regions, regions.size());
+        if (!index.has_value()) {
+            return false;
+        }
+        writeLogWeight(*index, logWeight);
+        return true;
+    }
+
+    /**
+     * @brief Replaces every log-weight at once, in region order, in O(n)
+     *
+     * This is the batch path for policies that emit a full logit vector per step: the values
+     * are copied and exponentiated in contiguous, vectorisable loops instead of one tree
+     * update per region.
+     *
+     * @param newLogWeights Pointer to size() log-weights, in the order regions were added
+     *        (removals move the last region into the removed slot)
+     * @param count Number of log-weights (must equal size())
+     * @throws std::invalid_argument if count differs from size() or any log-weight is NaN
+     *         or +infinity
+     */
+    void setLogWeights(const double* newLogWeights, size_t count) {
+        if (count != regions.size()) {
+            std::ostringstream msg;
+            msg << "LogitRouletteWheel::setLogWeights: expected " << regions.size()
+                << " log-weights, got " << count;
+            throw std::invalid_argument(msg.str());
+        }
+        for (size_t i = 0; i < count; ++i) {
+            validateLogWeight(newLogWeights[i], "setLogWeights");
+        }
+        std::copy(newLogWeights, newLogWeights + count, logWeights.begin());
+        rebuildStoredWeights();
+    }
+
+    /**
+     * @brief Removes an element from the wheel (the last region takes its place)
+     * @param element The element to remove
+     * @return true if the element was found and removed, false otherwise
+     */
+    bool removeElement(const E& element) {
+        const auto index = elementIndex.find(element, regions, regions.size());
+        if (!index.has_value()) {
+            return false;
+        }
+
+        const size_t last = regions.size() - 1;
+        if (*index != last) {
+            storedWeights.add(*index, stored[last] - stored[*index]);
+            stored[*index] = stored[last];
+            logWeights[*index] = logWeights[last];
+            elementIndex.onSwapErase(regions[*index].element, regions[last].element, *index, last);
+            regions[*index].element = std::move(regions[last].element);
+        } else {
+            elementIndex.onErase(regions[last].element, last, regions.size());
+        }
+        storedWeights.popBack(stored[last]);
+        stored.pop_back();
+        logWeights.pop_back();
+        regions.pop_back();
+        noteUpdate();
+        return true;
+    }
+
+    /**
+     * @brief Sets the softmax temperature (rebuilds the stored weights in O(n))
+     * @param temperature The new temperature
+     * @throws std::invalid_argument if temperature is not positive and finite
+     */
+    void setTemperature(double temperature) {
+        if (!(temperature > 0.0) || !std::isfinite(temperature)) {
+            std::ostringstream msg;
+            msg << "LogitRouletteWheel::setTemperature: temperature must be positive and finite, got "
+                << temperature;
+            throw std::invalid_argument(msg.str());
+        }
+        inverseTemperature = 1.0 / temperature;
+        rebuildStoredWeights();
+    }
+
+    /*** Query Methods ***/
+
+    /**
+     * @brief Checks if the wheel has no regions
+     * @return true if empty, false otherwise
+     */
+    bool empty() const {
+        return regions.empty();
+    }
+
+    /**
+     * @brief Gets the number of regions in the wheel
+     * @return Number of regions
+     */
+    size_t size() const {
+        return regions.size();
+    }
+
+    /**
+     * @brief Gets the softmax temperature
+     * @return The temperature
+     */
+    double getTemperature() const {
+        return 1.0 / inverseTemperature;
+    }
+
+    /**
+     * @brief Gets an element's log-weight
+     * @param element The element
+     * @return The log-weight, or -infinity if the element is not on the wheel
+     */
+    double getLogWeight(const E& element) const {
+        const auto index = elementIndex.find(element, regions, regions.size());
+        return index.has_value() ? logWeights[*index] : -std::numeric_limits<double>::infinity();
+    }
+
+    /**
+     * @brief Gets the cached log-sum-exp normaliser in O(1)
+     * @return log(sum of exp(logWeight / temperature)), or -infinity if nothing is selectable
+     */
+    double getLogNormalizer() const {
+        const double total = storedWeights.getTotal();
+        return total > 0.0 ? shift + std::log(total) : -std::numeric_limits<double>::infinity();
+    }
+
+    /**
+     * @brief Calculates an element's log selection probability
+     *
+     * Exact even when the probability itself is too small to represent as a double.
+     *
+     * @param element The element to query
+     * @return logWeight / temperature - getLogNormalizer(), or -infinity if element not found
+     */
+    double getLogProbability(const E& element) const {
+        const auto index = elementIndex.find(element, regions, regions.size());
+        if (!index.has_value() || storedWeights.getTotal() <= 0.0) {
+            return -std::numeric_limits<double>::infinity();
+        }
+        return logWeights[*index] * inverseTemperature - getLogNormalizer();
+    }
+
+    /**
+     * @brief Calculates the selection probability for an element
+     * @param element The element to query
+     * @return Probability fraction (0.0 to 1.0), or 0.0 if element not found
+     */
+    double getSelectionProbability(const E& element) const {
+        return std::exp(getLogProbability(element));
+    }
+
+    /**
+     * @brief Seeds the shared random number generator for the current thread.
+     * @param seed The seed value
+     * @note The engine is shared by all wheels on the calling thread.
+     */
+    void seedRandom(unsigned int seed) {
+        WheelRandom::seed(seed);
+    }
+
+private:
+    struct Region {
+        E element;
+
+        const E& getElement() const {
+            return element;
+        }
+    };
+
+    /// selectBatch sorts its draws once a batch has at least size() / sortedBatchDivisor of them
+    static constexpr size_t sortedBatchDivisor = 8;
+    /// Stored weights may grow to exp(maximumExponent) before the shift is moved up
+    static constexpr double maximumExponent = 64.0;
+    /// The stored weights are rebuilt once their total falls below this fraction of the total
+    /// at the last rebuild, before cancellation error in the tree becomes significant
+    static constexpr double minimumRetainedFraction = 0x1p-20;
+
+    /*** Member Variables ***/
+    double inverseTemperature = 1.0;
+    double shift = 0.0;            ///< Largest scaled log-weight at the last rebuild
+    double builtTotal = 0.0;       ///< Stored total right after the last rebuild
+    size_t updatesSinceBuild = 0;
+    std::vector<Region> regions;
+    std::vector<double> logWeights;
+    std::vector<double> stored;    ///< exp(logWeight * inverseTemperature - shift)
+    FenwickTree<double> storedWeights;
+    ElementIndex<E> elementIndex;
+
+    /*** Private Helper Methods ***/
+
+    /**
+     * @brief Writes one region's log-weight and its stored weight
+     * @param index Index of the region
+     * @param logWeight The new log-weight
+     */
+    void writeLogWeight(size_t index, double logWeight) {
+        logWeights[index] = logWeight;
+        const double scaled = logWeight * inverseTemperature;
+        if (scaled > shift + maximumExponent) {
+            rebuildStoredWeights();
+            return;
+        }
+        const double weight = std::exp(scaled - shift);
+        storedWeights.add(index, weight - stored[index]);
+        stored[index] = weight;
+        noteUpdate();
+    }
+
+    /**
+     * @brief Rebuilds after many incremental updates or a large loss of stored weight
+     */
+    void noteUpdate() {
+        if (++updatesSinceBuild >= regions.size() || lostStoredWeight()) {
+            rebuildStoredWeights();
+        }
+    }
+
+    /**
+     * @brief Checks whether so little stored weight is left that the shift should be lowered
+     *        (this includes a wheel whose every stored weight is 0)
+     */
+    bool lostStoredWeight() const {
+        return !(storedWeights.getTotal() > builtTotal * minimumRetainedFraction);
+    }
+
+    /**
+     * @brief Recomputes the shift and every stored weight from the log-weights in O(n)
+     */
+    void rebuildStoredWeights() {
+        const size_t count = logWeights.size();
+        double maximum = -std::numeric_limits<double>::infinity();
+        for (size_t i = 0; i < count; ++i) {
+            maximum = std::max(maximum, logWeights[i]);
+        }
+        shift = std::isfinite(maximum) ? maximum * inverseTemperature : 0.0;
+
+        stored.resize(count);
+        for (size_t i = 0; i < count; ++i) {
+            stored[i] = std::exp(logWeights[i] * inverseTemperature - shift);
+        }
+        storedWeights.build(count, [this](size_t i) { return stored[i]; });
+        builtTotal = storedWeights.getTotal();
+        updatesSinceBuild = 0;
+    }
+
+    /**
+     * @brief Gets the stored total, throwing if nothing can be selected
+     * @param caller Name of the calling method for the error message
+     * @return The positive stored total
+     */
+    double positiveTotal(const char* caller) const {
+        if (regions.empty()) {
+            std::ostringstream msg;
+            msg << "LogitRouletteWheel::" << caller << ": wheel is empty";
+            throw std::runtime_error(msg.str());
+        }
+        const double total = storedWeights.getTotal();
+        if (!(total > 0.0)) {
+            std::ostringstream msg;
+            msg << "LogitRouletteWheel::" << caller << ": no region has a finite log-weight";
+            throw std::runtime_error(msg.str());
+        }
+        return total;
+    }
+
+    /**
+     * @brief Computes log(exp(a) + exp(b)) without overflow or underflow
+     */
+    static double logAddExp(double a, double b) {
+        const double larger = std::max(a, b);
+        if (larger == -std::numeric_limits<double>::infinity()) {
+            return larger;
+        }
+        return larger + std::log1p(std::exp(std::min(a, b) - larger));
+    }
+
+    static void validateLogWeight(double logWeight, const char* caller) {
+        if (std::isnan(logWeight) || logWeight == std::numeric_limits<double>::infinity()) {
+            std::ostringstream msg;
+            msg << "LogitRouletteWheel::" << caller << ": log-weight must be finite or -infinity, got "
+                << logWeight;
+            throw std::invalid_argument(msg.str());
+        }
+    }
+};
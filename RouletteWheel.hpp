@@ -1,7 +1,12 @@
 #pragma once
 
 #include "classes/WheelRegion.hpp"
-#include <stevensMathLib.h>
+#include "classes/WheelRandom.hpp"
+#include "classes/FenwickTree.hpp"
+#include "classes/AliasTable.hpp"
+#include "classes/BucketedSampler.hpp"
+#include "classes/LazyBox.hpp"
+#include "classes/ElementIndex.hpp"
 #include <vector>
 #include <unordered_map>
 #include <tuple>
@@ -10,6 +15,31 @@
 #include <algorithm>
 #include <optional>
 #include <sstream>
+#include <utility>
+#include <cstdint>
+#include <memory>
+#include <memory_resource>
+#include <cmath>
+#include <type_traits>
+#include <array>
+#include <cstring>
+#include <variant>
+
+/**
+ * @brief Selection engines available to RouletteWheel
+ */
+enum class WheelStrategy {
+    Automatic,   ///< Pick an engine from the wheel's size and its observed reads and writes
+    LinearScan,  ///< Scan the regions on every draw: O(n) select, no upkeep on writes
+    PrefixSum,   ///< Cached cumulative weights + binary search: O(log n) select, O(n) rebuild after a weight change
+    AliasTable,  ///< Vose alias table: O(1) select, O(n) rebuild after any change
+    FenwickTree, ///< Binary indexed tree: O(log n) select and O(log n) weight changes
+    StochasticAcceptance, ///< Rejection sampling against the max weight: O(1) expected select and O(1)
+                          ///< weight changes when weights are not too skewed (only used when pinned)
+    PowerOfTwoBuckets     ///< Regions grouped by floor(log2(weight)): O(number of weight scales)
+                          ///< select and O(1) weight changes, appends and removals, independent of n.
+                          ///< Removing a region moves the last region into its place (only used when pinned)
+};
 
 /**
  * @brief A weighted random selection data structure using the roulette wheel algorithm.
@@ -18,11 +48,19 @@
  *
  * @tparam E Element type to store
  * @tparam W Weight type (must be numeric: int, float, double, etc.)
+ * @tparam Allocator Allocator used for the wheel's region storage. Use PmrRouletteWheel to
+ *         back short-lived wheels with a std::pmr::memory_resource such as a per-tick arena.
  *
+ * By default the wheel picks its selection engine itself: small wheels are scanned, and larger
+ * ones move between cached prefix sums, an alias table and a Fenwick tree depending on how
+ * often they are read versus written. Set Options::strategy to pin one engine instead.
  */
-template<typename E, typename W>
+template<typename E, typename W, typename Allocator = std::allocator<WheelRegion<E, W>>>
 class RouletteWheel {
 public:
+    /// Selection engines (see WheelStrategy)
+    using Strategy = WheelStrategy;
+
     /**
      * @brief Construction options for RouletteWheel
      */
@@ -33,6 +71,30 @@ public:
          * that clamped negatives to zero). Check empty() afterward to handle the all-zero case.
          */
         bool ignoreInvalidWeights = true;
+
+        /**
+         * @brief Selection engine. Automatic (the default) switches engines as the wheel's
+         * size and read/write mix change; any other value pins that engine.
+         */
+        Strategy strategy = Strategy::Automatic;
+
+        /**
+         * @brief When true, cereal archives append a block after the regions holding the weight
+         * transforms, the total weight, the active engine and its cache (cumulative weights,
+         * alias table or Fenwick tree), so a loaded wheel can draw without rebuilding. The
+         * archive layout follows this flag: a wheel loading such an archive must set it too,
+         * and a wheel without it reads regions-only archives, including those written before
+         * the block existed.
+         */
+        bool serializeCaches = false;
+
+        /**
+         * @brief When true, wheels of 64 or more regions keep a hash index of their elements,
+         * so lookups (addRegion, setWeight, removeElement, indexOf...) are O(1) on average
+         * instead of a scan. The index holds element hashes and region indices, never copies
+         * of the elements; it costs one table of two words per slot.
+         */
+        bool indexElements = false;
     };
 
     /*** Constructors ***/
@@ -42,12 +104,36 @@ public:
      */
     RouletteWheel() = default;
 
+    /**
+     * @brief Creates an empty roulette wheel whose storage comes from the given allocator
+     * @param allocator Allocator for the region storage
+     */
+    explicit RouletteWheel(const Allocator& allocator)
+        : RouletteWheel(Options{}, allocator) {
+    }
+
+    /**
+     * @brief Creates an empty roulette wheel with the given options
+     * @param options Wheel options (e.g. a pinned selection strategy)
+     * @param allocator Allocator for the region storage and the engine caches
+     */
+    explicit RouletteWheel(Options options, const Allocator& allocator = Allocator())
+        : options(options)
+        , regions(allocator)
+        , activeStrategy(initialStrategy(options.strategy))
+        , engineState(allocator)
+        , elementIndex(allocator) {
+    }
+
     /**
      * @brief Constructs a roulette wheel from an unordered map
      * @param elementWeightMap Map where keys are elements and values are weights
      * @param options Construction options (e.g. whether to skip non-positive weights)
+     * @param allocator Allocator for the region storage
      */
-    explicit RouletteWheel(const std::unordered_map<E, W>& elementWeightMap, Options options = {})
+    explicit RouletteWheel(const std::unordered_map<E, W>& elementWeightMap, Options options = {},
+                           const Allocator& allocator = Allocator())
+        : RouletteWheel(options, allocator)
     {
         regions.reserve(elementWeightMap.size());
         if( options.ignoreInvalidWeights )
@@ -74,8 +160,11 @@ public:
      * @brief Constructs a roulette wheel from a vector of element-weight tuples
      * @param elementWeightPairs Vector of (element, weight) tuples
      * @param options Construction options (e.g. whether to skip non-positive weights)
+     * @param allocator Allocator for the region storage
      */
-    explicit RouletteWheel(const std::vector<std::tuple<E, W>>& elementWeightPairs, Options options = {})
+    explicit RouletteWheel(const std::vector<std::tuple<E, W>>& elementWeightPairs, Options options = {},
+                           const Allocator& allocator = Allocator())
+        : RouletteWheel(options, allocator)
     {
         regions.reserve(elementWeightPairs.size());
         if( options.ignoreInvalidWeights )
@@ -106,21 +195,7 @@ public:
      * @throws std::runtime_error if the wheel is empty
      */
     E select() const {
-        if (regions.empty()) {
-            throw std::runtime_error(
-                "RouletteWheel::select: wheel is empty — either it was constructed with no entries, "
-                "all entries had weight <= 0 (use Options{.ignoreInvalidWeights=true} to skip them), "
-                "or all elements were removed");
-        }
-
-        if (regions.size() == 1) {
-            return regions[0].getElement();
-        }
-
-        const W totalWeight = calculateTotalWeight();
-        const W randomValue = generateRandomWeight(totalWeight);
-
-        return selectElementByWeight(randomValue);
+        return regions[selectIndex()].getElement();
     }
 
     /**
@@ -134,6 +209,97 @@ public:
         return select();
     }
 
+    /**
+     * @brief Selects an element among the regions a mask leaves enabled, renormalising their
+     *        weights on the fly without modifying the wheel
+     * @param enabled One flag per region, in getRegions() order; false excludes the region
+     * @return The selected element
+     * @throws std::invalid_argument if the mask's size differs from the number of regions
+     * @throws std::runtime_error if the wheel is empty or the mask enables no region
+     * @note Costs one pass over the mask; masks that exclude only a few regions then draw from
+     *       the cached cumulative weights instead of scanning the weights.
+     */
+    E select(const std::vector<bool>& enabled) const {
+        return regions[selectMaskedIndex(enabled)].getElement();
+    }
+
+    /**
+     * @brief Selects an element while excluding some regions by index, renormalising the
+     *        remaining weights on the fly without modifying the wheel
+     * @param excludedIndices Indices (in getRegions() order) of the regions to skip, in any
+     *        order; duplicates are ignored
+     * @return The selected element
+     * @throws std::out_of_range if an index is not less than size()
+     * @throws std::runtime_error if the wheel is empty or every region is excluded
+     * @note Costs O(k log k + log n) for k excluded regions once the cumulative weights are
+     *       cached (O(k log n) while the Fenwick tree engine is active), so it is the fastest
+     *       way to skip a few regions of a large wheel.
+     */
+    E selectExcluding(const std::vector<size_t>& excludedIndices) const {
+        noteRead();
+
+        std::vector<size_t, IndexAllocator>& maskedIndices = scratchIndices();
+        maskedIndices.assign(excludedIndices.begin(), excludedIndices.end());
+        if (!std::is_sorted(maskedIndices.begin(), maskedIndices.end())) {
+            std::sort(maskedIndices.begin(), maskedIndices.end());
+        }
+        maskedIndices.erase(std::unique(maskedIndices.begin(), maskedIndices.end()), maskedIndices.end());
+        if (!maskedIndices.empty() && maskedIndices.back() >= regions.size()) {
+            std::ostringstream msg;
+            msg << "RouletteWheel::selectExcluding: index " << maskedIndices.back()
+                << " is out of range for " << regions.size() << " regions";
+            throw std::out_of_range(msg.str());
+        }
+        if (maskedIndices.size() == regions.size()) {
+            throw std::runtime_error("RouletteWheel::selectExcluding: every region is excluded");
+        }
+        if (maskedIndices.empty()) {
+            return regions[selectIndexWithActiveEngine()].getElement();
+        }
+
+        const auto isEnabled = [&maskedIndices](size_t i) {
+            return !std::binary_search(maskedIndices.begin(), maskedIndices.end(), i);
+        };
+        if (isTransformed()) {
+            return regions[selectTransformedIndexWhere(isEnabled)].getElement();
+        }
+        // The list is already sorted, so even a long one is walked in O(k) rather than tested per region
+        if (regions.size() >= minimumAdaptiveSize) {
+            return regions[selectIndexExcluding(isEnabled)].getElement();
+        }
+        return regions[selectIndexWhere(isEnabled)].getElement();
+    }
+
+    /**
+     * @brief Selects an element among those satisfying a predicate, renormalising their
+     *        weights on the fly without modifying the wheel
+     * @param isEligible Callable taking const E& and returning true for selectable elements
+     * @return The selected element
+     * @throws std::runtime_error if the wheel is empty or no element satisfies the predicate
+     */
+    template<typename Predicate>
+    E selectIf(Predicate isEligible) const {
+        noteRead();
+
+        std::vector<size_t, IndexAllocator>& maskedIndices = scratchIndices();
+        maskedIndices.clear();
+        for (size_t i = 0; i < regions.size(); ++i) {
+            if (isEligible(regions[i].getElement())) {
+                maskedIndices.push_back(i);
+            }
+        }
+        if (maskedIndices.empty()) {
+            throw std::runtime_error("RouletteWheel::selectIf: no element satisfies the predicate");
+        }
+        if (isTransformed()) {
+            const std::vector<size_t, IndexAllocator>& candidates = maskedIndices;
+            return regions[selectTransformedIndexWhere([&candidates](size_t i) {
+                return std::binary_search(candidates.begin(), candidates.end(), i);
+            })].getElement();
+        }
+        return regions[selectIndexAmong(maskedIndices)].getElement();
+    }
+
     /**
      * @brief Selects an element and modifies its weight
      * @param weightDelta Amount to add to the selected element's weight (can be negative)
@@ -141,20 +307,35 @@ public:
      * @throws std::runtime_error if the wheel is empty
      */
     E selectAndModifyWeight(W weightDelta = -1) {
-        const E selectedElement = select();
-        modifyElementWeight(selectedElement, weightDelta);
-        return selectedElement;
+        const size_t index = selectIndex();
+        const W newWeight = regions[index].getWeight() + toStoredWeight(weightDelta);
+        if (newWeight <= 0) {
+            return extractRegionAt(index);
+        }
+
+        replaceWeightAtIndex(index, newWeight);
+        return regions[index].getElement();
     }
 
     /**
      * @brief Selects an element and removes it from the wheel
-     * @return The selected element
+     * @return The selected element, moved out of the wheel rather than copied
      * @throws std::runtime_error if the wheel is empty
      */
     E selectAndRemove() {
-        const E selectedElement = select();
-        removeElement(selectedElement);
-        return selectedElement;
+        return extractRegionAt(selectIndex());
+    }
+
+    /**
+     * @brief Selects an element and removes it from the wheel (safe version)
+     * @return Optional containing the selected element (moved out of the wheel),
+     *         or nullopt if the wheel is empty
+     */
+    std::optional<E> selectAndRemoveSafe() {
+        if (regions.empty()) {
+            return std::nullopt;
+        }
+        return selectAndRemove();
     }
 
     /*** Modification Methods ***/
@@ -166,14 +347,29 @@ public:
      * @throws std::invalid_argument if weight is negative or zero
      */
     void addRegion(const E& element, W weight) {
-        if (weight <= 0) {
-            std::ostringstream msg;
-            msg << "RouletteWheel::addRegion: weight must be positive, got " << weight
-                << " (use Options{.ignoreInvalidWeights=true} in the constructor to skip such entries)";
-            throw std::invalid_argument(msg.str());
+        validateWeight(weight, "addRegion");
+        weight = toStoredWeight(weight);
+
+        const auto existingIndex = findElementIndex(element);
+        if (existingIndex.has_value()) {
+            combineWeightAtIndex(*existingIndex, weight);
+            return;
         }
 
-        totalWeightDirty = true;
+        regions.emplace_back(element, weight);
+        onRegionAppended(weight);
+    }
+
+    /**
+     * @brief Adds a new region to the wheel or combines weight if element exists,
+     *        moving the element into the wheel instead of copying it
+     * @param element The element to add (left moved-from only if a new region was created)
+     * @param weight The weight for this element (must be positive)
+     * @throws std::invalid_argument if weight is negative or zero
+     */
+    void addRegion(E&& element, W weight) {
+        validateWeight(weight, "addRegion");
+        weight = toStoredWeight(weight);
 
         const auto existingIndex = findElementIndex(element);
         if (existingIndex.has_value()) {
@@ -181,13 +377,39 @@ public:
             return;
         }
 
-        regions.emplace_back(element, weight);
+        regions.emplace_back(std::move(element), weight);
+        onRegionAppended(weight);
+    }
+
+    /**
+     * @brief Constructs an element in place at the end of the wheel, or combines its weight
+     *        into an existing equal element
+     * @param weight The weight for this element (must be positive)
+     * @param args Arguments forwarded to the element's constructor
+     * @throws std::invalid_argument if weight is negative or zero
+     */
+    template<typename... Args>
+    void emplaceRegion(W weight, Args&&... args) {
+        validateWeight(weight, "emplaceRegion");
+        weight = toStoredWeight(weight);
+
+        regions.emplace_back(std::in_place, weight, std::forward<Args>(args)...);
+
+        const auto existingIndex = findElementIndex(regions.back().getElement(), regions.size() - 1);
+        if (existingIndex.has_value()) {
+            regions.pop_back();
+            combineWeightAtIndex(*existingIndex, weight);
+            return;
+        }
+        onRegionAppended(weight);
     }
 
     /**
      * @brief Removes a specific element from the wheel
      * @param element The element to remove
      * @return true if element was found and removed, false otherwise
+     * @note On wheels pinned to PowerOfTwoBuckets the last region takes the removed region's
+     *       place in getRegions(), so the erase is O(1); other wheels keep their order.
      */
     bool removeElement(const E& element) {
         const auto index = findElementIndex(element);
@@ -195,229 +417,2041 @@ public:
             return false;
         }
 
-        totalWeightDirty = true;
-        regions.erase(regions.begin() + *index);
+        eraseRegionAt(*index);
         return true;
     }
 
     /**
-     * @brief Removes all regions with weight <= 0
-     * @return Number of regions removed
-     */
-    size_t removeInvalidRegions() {
-        const size_t originalSize = regions.size();
-        totalWeightDirty = true;
-        regions.erase(
-            std::remove_if(regions.begin(), regions.end(),
-                [](const WheelRegion<E, W>& region) {
-                    return region.getWeight() <= 0;
-                }),
-            regions.end()
-        );
-        return originalSize - regions.size();
-    }
-
-    /*** Query Methods ***/
-
-    /**
-     * @brief Checks if the wheel has no regions
-     * @return true if empty, false otherwise
+     * @brief Replaces the weight of an element in place
+     * @param element The element to update
+     * @param weight The new weight (must be positive)
+     * @return true if the element was found, false otherwise
+     * @throws std::invalid_argument if weight is negative or zero
+     * @note Only the engine caches that support in-place updates are kept (the Fenwick tree
+     *       and buckets in O(log n) / O(1)); no region is moved.
      */
-    bool empty() const {
-        return regions.empty();
+    bool setWeight(const E& element, W weight) {
+        validateWeight(weight, "setWeight");
+        const auto index = findElementIndex(element);
+        if (!index.has_value()) {
+            return false;
+        }
+        replaceWeightAtIndex(*index, toStoredWeight(weight));
+        return true;
     }
 
     /**
-     * @brief Gets the number of regions in the wheel
-     * @return Number of regions
+     * @brief Replaces the weight of the region at an index in place
+     * @param index Index of the region, in getRegions() order
+     * @param weight The new weight (must be positive)
+     * @throws std::invalid_argument if weight is negative or zero
+     * @throws std::out_of_range if index is not less than size()
      */
-    size_t size() const {
-        return regions.size();
+    void setWeightAt(size_t index, W weight) {
+        validateWeight(weight, "setWeightAt");
+        validateIndex(index, "setWeightAt");
+        replaceWeightAtIndex(index, toStoredWeight(weight));
     }
 
     /**
-     * @brief Calculates the selection probability for an element as a fraction
-     * @param element The element to query
-     * @return Probability fraction (0.0 to 1.0), or 0.0 if element not found
+     * @brief Adds a delta to the weight of an element, removing its region if the weight
+     *        drops to zero or below (like selectAndModifyWeight)
+     * @param element The element to update
+     * @param weightDelta Amount to add to the element's weight (can be negative)
+     * @return true if the element was found, false otherwise
      */
-    double getSelectionProbability(const E& element) const {
-        if (regions.empty()) {
-            return 0.0;
-        }
-
-        const auto elementWeight = findElementWeight(element);
-        if (!elementWeight.has_value()) {
-            return 0.0;
-        }
-
-        const W totalWeight = calculateTotalWeight();
-        if (totalWeight <= 0) {
-            return 0.0;
+    bool adjustWeight(const E& element, W weightDelta) {
+        const auto index = findElementIndex(element);
+        if (!index.has_value()) {
+            return false;
         }
-
-        return static_cast<double>(*elementWeight) / static_cast<double>(totalWeight);
+        adjustWeightAtIndex(*index, weightDelta);
+        return true;
     }
 
     /**
-     * @brief Gets a const reference to all wheel regions
-     * @return Const reference to the regions vector
+     * @brief Adds a delta to the weight of the region at an index, removing the region if
+     *        the weight drops to zero or below
+     * @param index Index of the region, in getRegions() order
+     * @param weightDelta Amount to add to the region's weight (can be negative)
+     * @throws std::out_of_range if index is not less than size()
      */
-    const std::vector<WheelRegion<E, W>>& getRegions() const {
-        return regions;
+    void adjustWeightAt(size_t index, W weightDelta) {
+        validateIndex(index, "adjustWeightAt");
+        adjustWeightAtIndex(index, weightDelta);
     }
 
     /**
-     * @brief Seeds the shared random number generator for the current thread.
-     * @param seed The seed value
-     * @note The engine is shared by all RouletteWheels on the calling thread, so this
-     *       affects subsequent selections on every wheel used by this thread.
+     * @brief Reserves storage for at least the given number of regions, plus what filling
+     *        them needs: the adaptive usage history of an automatic wheel that will reach
+     *        minimumAdaptiveSize regions and, with Options::indexElements, element index slots
+     * @param capacity Number of regions to reserve room for
      */
-    void seedRandom(unsigned int seed) {
-        stevensMathLib::setSeed(seed);
+    void reserve(size_t capacity) {
+        regions.reserve(capacity);
+        if (options.strategy == Strategy::Automatic && capacity >= minimumAdaptiveSize) {
+            engineState.getOrCreate();
+        }
+        if (options.indexElements) {
+            elementIndex.reserve(capacity);
+        }
     }
 
-private:
-    /*** Member Variables ***/
-    std::vector<WheelRegion<E, W>> regions;
-    mutable W totalWeight = W{0};
-    mutable bool totalWeightDirty = true;
-
     /**
-     * @brief The random engine is only used at selection time and carries no per-wheel state,
-     *        so a single engine is shared across all wheels rather than stored (and seeded)
-     *        per instance. It is thread_local because std::mt19937 is not thread-safe and
-     *        wheels may be used from worker threads (e.g. month resolution).
+     * @brief Removes all regions with weight <= 0
+     * @return Number of regions removed
      */
-    static std::mt19937& sharedEngine() {
-        return stevensMathLib::getRandomEngine();
+    size_t removeInvalidRegions() {
+        const size_t originalSize = regions.size();
+        regions.erase(
+            std::remove_if(regions.begin(), regions.end(),
+                [](const WheelRegion<E, W>& region) {
+                    return region.getWeight() <= 0;
+                }),
+            regions.end()
+        );
+        if (regions.size() != originalSize) {
+            onRegionsRestructured();
+        }
+        return originalSize - regions.size();
     }
 
-    /*** Private Helper Methods ***/
+    /*** Batch Edits ***/
 
     /**
-     * @brief Calculates the sum of all region weights
-     * @return Total weight
+     * @brief A set of edits applied to a wheel as one transaction (see edit())
+     *
+     * Edits are written straight into the wheel's regions without touching its caches. Removed
+     * regions are only marked until the batch commits, so a removal is O(1) instead of an O(n)
+     * erase, and an undo log of overwritten weights lets a failed batch restore the wheel.
      */
-    W calculateTotalWeight() const {
-        if (totalWeightDirty) {
-            totalWeight = W{0};
-            for (const auto& region : regions) {
-                totalWeight += region.getWeight();
+    class Batch {
+    public:
+        /**
+         * @brief Adds a region, or combines the weight into an equal element's region
+         *        (an element removed earlier in the batch is restored with just this weight)
+         * @param element The element to add
+         * @param weight The weight for this element (must be positive)
+         * @throws std::invalid_argument if weight is negative or zero
+         */
+        void addRegion(const E& element, W weight) {
+            wheel.validateWeight(weight, "Batch::addRegion");
+            if (!combineOrRestore(element, weight)) {
+                wheel.regions.emplace_back(element, wheel.toStoredWeight(weight));
+                noteAppend();
             }
-            totalWeightDirty = false;
         }
-        return totalWeight;
-    }
 
-    /**
-     * @brief Generates a random weight value in the range [0, maxWeight)
-     * @param maxWeight Upper bound (exclusive)
-     * @return Random weight value
-     */
-    W generateRandomWeight(W maxWeight) const {
-        if constexpr (std::is_integral_v<W>) {
-            std::uniform_int_distribution<W> distribution(0, maxWeight - 1);
-            return distribution(sharedEngine());
-        } else {
-            std::uniform_real_distribution<W> distribution(0.0, static_cast<double>(maxWeight));
-            return distribution(sharedEngine());
+        /**
+         * @brief Adds a region, moving the element into the wheel instead of copying it
+         * @param element The element to add (left moved-from only if a new region was created)
+         * @param weight The weight for this element (must be positive)
+         * @throws std::invalid_argument if weight is negative or zero
+         */
+        void addRegion(E&& element, W weight) {
+            wheel.validateWeight(weight, "Batch::addRegion");
+            if (!combineOrRestore(element, weight)) {
+                wheel.regions.emplace_back(std::move(element), wheel.toStoredWeight(weight));
+                noteAppend();
+            }
         }
-    }
 
-    /**
-     * @brief Selects an element based on a random weight value
-     * @param randomValue The random value to use for selection
-     * @return The selected element
-     */
-    E selectElementByWeight(W randomValue) const {
-        W accumulatedWeight = 0;
-        for (const auto& region : regions) {
-            accumulatedWeight += region.getWeight();
-            if (accumulatedWeight > randomValue) {
-                return region.getElement();
+        /**
+         * @brief Removes an element when the batch commits
+         * @param element The element to remove
+         * @return true if the element was in the wheel (and not already removed by this batch)
+         */
+        bool removeElement(const E& element) {
+            const auto index = findLive(element);
+            if (!index.has_value()) {
+                return false;
+            }
+            if (removed.size() < wheel.regions.size()) {
+                removed.resize(wheel.regions.size(), false);
             }
+            removed[*index] = true;
+            ++removedCount;
+            return true;
         }
 
-        // Fallback to last element (handles floating-point rounding edge cases)
-        return regions.back().getElement();
-    }
-
-    /**
-     * @brief Finds the index of an element in the regions vector
-     * @param element The element to find
-     * @return Optional containing the index, or nullopt if not found
-     */
-    std::optional<size_t> findElementIndex(const E& element) const {
-        for (size_t i = 0; i < regions.size(); ++i) {
-            if (regions[i].getElement() == element) {
-                return i;
+        /**
+         * @brief Replaces the weight of an element
+         * @param element The element to update
+         * @param weight The new weight (must be positive)
+         * @return true if the element was in the wheel (and not removed by this batch)
+         * @throws std::invalid_argument if weight is negative or zero
+         */
+        bool setWeight(const E& element, W weight) {
+            wheel.validateWeight(weight, "Batch::setWeight");
+            const auto index = findLive(element);
+            if (!index.has_value()) {
+                return false;
             }
+            writeWeight(*index, wheel.toStoredWeight(weight));
+            return true;
         }
-        return std::nullopt;
-    }
 
-    /**
-     * @brief Finds the weight of an element
-     * @param element The element to find
-     * @return Optional containing the weight, or nullopt if not found
-     */
-    std::optional<W> findElementWeight(const E& element) const {
-        const auto index = findElementIndex(element);
-        if (!index.has_value()) {
-            return std::nullopt;
+        /**
+         * @brief Reserves room for regions the batch is about to add
+         * @param additionalRegions Number of new regions expected
+         */
+        void reserve(size_t additionalRegions) {
+            wheel.reserve(wheel.regions.size() + additionalRegions);
         }
-        return regions[*index].getWeight();
-    }
 
-    /**
-     * @brief Combines weight to an existing region at the specified index
-     * @param index Index of the region
-     * @param additionalWeight Weight to add
-     */
-    void combineWeightAtIndex(size_t index, W additionalWeight) {
-        const W newWeight = regions[index].getWeight() + additionalWeight;
-        regions[index].setWeight(newWeight);
-    }
+    private:
+        friend class RouletteWheel;
 
-    /**
-     * @brief Modifies the weight of an element and removes it if weight becomes invalid
-     * @param element The element to modify
-     * @param weightDelta Amount to add to the weight
-     */
-    void modifyElementWeight(const E& element, W weightDelta) {
-        const auto index = findElementIndex(element);
-        if (!index.has_value()) {
-            return;
+        using FlagAllocator = typename std::allocator_traits<Allocator>::template rebind_alloc<bool>;
+        using UndoAllocator = typename std::allocator_traits<Allocator>::template
+            rebind_alloc<std::pair<size_t, W>>;
+
+        explicit Batch(RouletteWheel& wheel)
+            : wheel(wheel),
+              originalSize(wheel.regions.size()),
+              removed(FlagAllocator(wheel.regions.get_allocator())),
+              undoLog(UndoAllocator(wheel.regions.get_allocator())) {
         }
 
-        totalWeightDirty = true;
+        RouletteWheel& wheel;
+        size_t originalSize;                                ///< Regions before the batch (later ones are new)
+        std::vector<bool, FlagAllocator> removed;           ///< Regions to drop at commit (grown on first removal)
+        size_t removedCount = 0;
+        std::vector<std::pair<size_t, W>, UndoAllocator> undoLog; ///< Overwritten weights of pre-existing regions
+        size_t weightChanges = 0;
 
-        const W newWeight = regions[*index].getWeight() + weightDelta;
-        if (newWeight <= 0) {
-            regions.erase(regions.begin() + *index);
-            return;
+        bool isRemoved(size_t index) const {
+            return index < removed.size() && removed[index];
         }
 
-        regions[*index].setWeight(newWeight);
+        std::optional<size_t> findLive(const E& element) const {
+            const auto index = wheel.findElementIndex(element);
+            if (!index.has_value() || isRemoved(*index)) {
+                return std::nullopt;
+            }
+            return index;
+        }
+
+        void writeWeight(size_t index, W weight) {
+            if (index < originalSize) {
+                undoLog.emplace_back(index, wheel.regions[index].getWeight());
+            }
+            wheel.regions[index].setWeight(weight);
+            ++weightChanges;
+        }
+
+        bool combineOrRestore(const E& element, W weight) {
+            const auto index = wheel.findElementIndex(element);
+            if (!index.has_value()) {
+                return false;
+            }
+            const W stored = wheel.toStoredWeight(weight);
+            if (isRemoved(*index)) {
+                removed[*index] = false;
+                --removedCount;
+                writeWeight(*index, stored);
+            } else {
+                writeWeight(*index, wheel.regions[*index].getWeight() + stored);
+            }
+            return true;
+        }
+
+        void noteAppend() {
+            wheel.elementIndex.onAppend(wheel.regions.back().getElement(), wheel.regions.size() - 1);
+        }
+
+        /**
+         * @brief Drops the removed regions in one stable pass and invalidates the caches once
+         * @throws Whatever copying a kept region throws, after rolling the batch back
+         */
+        void commit() {
+            const size_t appended = wheel.regions.size() - originalSize;
+            if (removedCount > 0) {
+                try {
+                    dropRemoved();
+                } catch (...) {
+                    rollback();
+                    throw;
+                }
+                wheel.elementIndex.invalidate();
+            }
+            if (appended + removedCount + weightChanges == 0) {
+                return;
+            }
+            wheel.invalidateCaches();
+            wheel.noteOperations(UsageStats{0.0, static_cast<double>(weightChanges),
+                                            static_cast<double>(appended), static_cast<double>(removedCount)});
+        }
+
+        /**
+         * @brief Removes the marked regions, keeping the order of the rest
+         *
+         * Regions that move without throwing are compacted in place. Otherwise the kept regions
+         * are copied into a new vector that is swapped in only once it is complete, so a throw
+         * leaves the wheel's regions exactly as the batch left them and rollback can still undo it.
+         */
+        void dropRemoved() {
+            using Region = WheelRegion<E, W>;
+            if constexpr (std::is_nothrow_move_assignable_v<Region>) {
+                size_t kept = 0;
+                for (size_t i = 0; i < wheel.regions.size(); ++i) {
+                    if (!isRemoved(i)) {
+                        if (kept != i) {
+                            wheel.regions[kept] = std::move(wheel.regions[i]);
+                        }
+                        ++kept;
+                    }
+                }
+                wheel.regions.erase(wheel.regions.begin() + kept, wheel.regions.end());
+            } else {
+                std::vector<Region, Allocator> kept(wheel.regions.get_allocator());
+                kept.reserve(wheel.regions.size() - removedCount);
+                for (size_t i = 0; i < wheel.regions.size(); ++i) {
+                    if (!isRemoved(i)) {
+                        kept.push_back(std::move_if_noexcept(wheel.regions[i]));
+                    }
+                }
+                wheel.regions.swap(kept);
+            }
+        }
+
+        /**
+         * @brief Restores the wheel to its state before the batch; its caches were never touched
+         */
+        void rollback() noexcept {
+            for (auto entry = undoLog.rbegin(); entry != undoLog.rend(); ++entry) {
+                wheel.regions[entry->first].setWeight(entry->second);
+            }
+            while (wheel.regions.size() > originalSize) {
+                const size_t last = wheel.regions.size() - 1;
+                wheel.elementIndex.onErase(wheel.regions[last].getElement(), last, last + 1);
+                wheel.regions.pop_back();
+            }
+        }
+    };
+
+    /**
+     * @brief Applies a batch of adds, removals and weight changes as one transaction
+     *
+     * The edits are applied as they are made, but the caches are invalidated only once, when
+     * the callable returns, and removals are compacted in a single pass; applying many edits
+     * this way costs one cache rebuild instead of one per edit. If the callable throws (or an
+     * edit is invalid), every edit is undone and the exception is rethrown, leaving the wheel
+     * and its caches exactly as they were.
+     *
+     * @code
+     * wheel.edit([&](auto& tx) {
+     *     tx.removeElement("sword");
+     *     tx.setWeight("shield", 4.0);
+     *     tx.addRegion("bow", 2.0);
+     * });
+     * @endcode
+     *
+     * @param edits Callable taking a Batch& (the wheel itself must not be used until it returns)
+     * @throws Whatever edits throws, or whatever copying a kept region throws while removals
+     *         are applied (only for elements whose move may throw), after rolling the batch back
+     */
+    template<typename Edits>
+    void edit(Edits&& edits) {
+        Batch batch(*this);
+        try {
+            std::forward<Edits>(edits)(batch);
+        } catch (...) {
+            batch.rollback();
+            throw;
+        }
+        batch.commit();
+    }
+
+    /*** Weight Transforms ***/
+
+    /**
+     * @brief Multiplies every region's effective weight by a factor in O(1)
+     *
+     * The factor is kept as a wheel-level parameter instead of being applied to each region.
+     * Weights passed to the wheel afterwards (addRegion, emplaceRegion, selectAndModifyWeight)
+     * are in the same scaled units, so they compete with the scaled existing weights. Stored
+     * weights (getRegions()) are divided by getWeightScale(); the scale is folded into them
+     * once it drifts past 2^32 either way.
+     *
+     * @param factor Positive, finite multiplier (it also scales the weight offset)
+     * @throws std::invalid_argument if factor is not positive and finite
+     */
+    void scaleWeights(double factor) {
+        static_assert(std::is_floating_point_v<W>, "scaleWeights requires floating-point weights");
+        validateTransformParameter(factor, "scaleWeights");
+
+        // Scaling every effective weight by the same factor leaves the distribution unchanged,
+        // so only the cached effective weights (kept in absolute units) need refreshing
+        weightScale *= factor;
+        weightOffset *= factor;
+        invalidateTransformedSums();
+        if (weightScale > weightScaleLimit || weightScale < 1.0 / weightScaleLimit) {
+            foldWeightScale();
+        }
+    }
+
+    /**
+     * @brief Adds a constant to every region's (scaled) weight before selection, without
+     *        touching per-region storage. Regions whose offset weight is not positive are
+     *        never selected.
+     * @param offset The offset, in the same units as the weights (0 removes it)
+     * @throws std::invalid_argument if offset is not finite
+     * @note While an offset or temperature is set, selection draws from cumulative effective
+     *       weights rebuilt in O(n) after each change (appends extend them in O(1)).
+     */
+    void setWeightOffset(double offset) {
+        if (!std::isfinite(offset)) {
+            throw std::invalid_argument("RouletteWheel::setWeightOffset: offset must be finite");
+        }
+        weightOffset = offset;
+        invalidateTransformedSums();
+    }
+
+    /**
+     * @brief Raises every region's effective weight to the power 1 / temperature in O(1)
+     *
+     * Temperatures below 1 sharpen the distribution towards the heaviest regions; above 1
+     * flatten it towards uniform; 1 leaves the weights as they are.
+     *
+     * @param newTemperature Positive, finite temperature
+     * @throws std::invalid_argument if newTemperature is not positive and finite
+     */
+    void setTemperature(double newTemperature) {
+        validateTransformParameter(newTemperature, "setTemperature");
+        temperature = newTemperature;
+        invalidateTransformedSums();
+    }
+
+    /**
+     * @brief Gets the lazy multiplier applied to the stored weights
+     * @return The weight scale (1 unless scaleWeights was called)
+     */
+    double getWeightScale() const {
+        return weightScale;
+    }
+
+    /**
+     * @brief Gets the offset added to every scaled weight
+     * @return The weight offset
+     */
+    double getWeightOffset() const {
+        return weightOffset;
+    }
+
+    /**
+     * @brief Gets the selection temperature
+     * @return The temperature (1 leaves the weights unchanged)
+     */
+    double getTemperature() const {
+        return temperature;
+    }
+
+    /*** Query Methods ***/
+
+    /**
+     * @brief Checks if the wheel has no regions
+     * @return true if empty, false otherwise
+     */
+    bool empty() const {
+        return regions.empty();
+    }
+
+    /**
+     * @brief Gets the number of regions in the wheel
+     * @return Number of regions
+     */
+    size_t size() const {
+        return regions.size();
+    }
+
+    /**
+     * @brief Calculates the selection probability for an element as a fraction
+     * @param element The element to query
+     * @return Probability fraction (0.0 to 1.0), or 0.0 if element not found
+     * @note O(n) to find the element; the total weight is cached.
+     */
+    double getSelectionProbability(const E& element) const {
+        const auto index = findElementIndex(element);
+        if (!index.has_value()) {
+            return 0.0;
+        }
+        return probabilityAt(*index);
+    }
+
+    /**
+     * @brief Calculates the selection probability of the region at an index, without an
+     *        element lookup
+     * @param index Index of the region, in getRegions() order
+     * @return Probability fraction (0.0 to 1.0)
+     * @throws std::out_of_range if index is not less than size()
+     */
+    double getSelectionProbabilityAt(size_t index) const {
+        validateIndex(index, "getSelectionProbabilityAt");
+        return probabilityAt(index);
+    }
+
+    /**
+     * @brief Writes the selection probability of every region, in getRegions() order, in
+     *        one pass over the weights
+     * @param out Destination for size() probabilities
+     * @param count Number of doubles out has room for (must equal size())
+     * @throws std::invalid_argument if count does not equal size()
+     * @note Each value equals getSelectionProbabilityAt(i); filling a table of n drop rates
+     *       this way costs O(n) with no element hashing.
+     */
+    void probabilities(double* out, size_t count) const {
+        if (count != regions.size()) {
+            std::ostringstream msg;
+            msg << "RouletteWheel::probabilities: output holds " << count
+                << " values but the wheel has " << regions.size() << " regions";
+            throw std::invalid_argument(msg.str());
+        }
+        if (regions.empty()) {
+            return;
+        }
+
+        if (isTransformed()) {
+            const double total = transformedSums().back();
+            if (total <= 0.0) {
+                std::fill(out, out + count, 0.0);
+                return;
+            }
+            for (size_t i = 0; i < count; ++i) {
+                out[i] = transformedWeight(i) / total;
+            }
+            return;
+        }
+
+        const W totalWeight = currentTotalWeight();
+        if (totalWeight <= 0) {
+            std::fill(out, out + count, 0.0);
+            return;
+        }
+        const double total = static_cast<double>(totalWeight);
+        for (size_t i = 0; i < count; ++i) {
+            out[i] = static_cast<double>(regions[i].getWeight()) / total;
+        }
+    }
+
+    /**
+     * @brief Gets the selection probability of every region, in getRegions() order
+     * @return One probability per region
+     */
+    std::vector<double> probabilities() const {
+        std::vector<double> result(regions.size());
+        probabilities(result.data(), result.size());
+        return result;
+    }
+
+    /**
+     * @brief Gets the wheel's options
+     * @return The options the wheel was constructed with (reflecting any later setStrategy call)
+     */
+    const Options& getOptions() const {
+        return options;
+    }
+
+    /**
+     * @brief Gets the configured selection strategy
+     * @return Strategy::Automatic, or the pinned engine
+     */
+    Strategy getStrategy() const {
+        return options.strategy;
+    }
+
+    /**
+     * @brief Gets the engine currently used for selection
+     * @return The active engine (never Strategy::Automatic). A wheel pinned to
+     *         StochasticAcceptance reports FenwickTree while its weights are too skewed
+     *         for rejection sampling.
+     */
+    Strategy getActiveStrategy() const {
+        return activeStrategy;
+    }
+
+    /**
+     * @brief Pins a selection engine, or returns the wheel to automatic engine selection
+     * @param strategy The engine to use, or Strategy::Automatic
+     */
+    void setStrategy(Strategy strategy) {
+        options.strategy = strategy;
+        if (EngineState* state = engineState.get()) {
+            state->recentUsage = UsageStats{};
+            state->pastUsage = UsageStats{};
+            state->operationsSinceReview = 0;
+            state->rebuildsSinceReview = 0;
+        }
+        if (strategy != Strategy::Automatic) {
+            switchStrategy(strategy);
+        } else if (activeStrategy == Strategy::StochasticAcceptance) {
+            switchStrategy(Strategy::LinearScan);  // Automatic mode never picks rejection sampling itself
+        }
+    }
+
+    /**
+     * @brief Gets a const reference to all wheel regions
+     * @return Const reference to the regions vector
+     */
+    const std::vector<WheelRegion<E, W>, Allocator>& getRegions() const {
+        return regions;
+    }
+
+    /**
+     * @brief Finds the position of an element in getRegions()
+     * @param element The element to find
+     * @return Optional containing the index, or nullopt if not found
+     */
+    std::optional<size_t> indexOf(const E& element) const {
+        return findElementIndex(element);
+    }
+
+    /**
+     * @brief Gets a copy of the allocator used for region storage
+     * @return The wheel's allocator
+     */
+    Allocator getAllocator() const {
+        return regions.get_allocator();
+    }
+
+    /**
+     * @brief Seeds the shared random number generator for the current thread.
+     * @param seed The seed value
+     * @note The engine is shared by all RouletteWheels on the calling thread, so this
+     *       affects subsequent selections on every wheel used by this thread.
+     */
+    void seedRandom(unsigned int seed) {
+        WheelRandom::seed(seed);
+    }
+
+private:
+    using WeightAllocator = typename std::allocator_traits<Allocator>::template rebind_alloc<W>;
+    using DoubleAllocator = typename std::allocator_traits<Allocator>::template rebind_alloc<double>;
+    using IndexAllocator = typename std::allocator_traits<Allocator>::template rebind_alloc<size_t>;
+
+    /**
+     * @brief Operation counts seen by the adaptive strategy
+     */
+    struct UsageStats {
+        double reads = 0.0;
+        double weightChanges = 0.0;
+        double appends = 0.0;
+        double erases = 0.0;
+    };
+
+    /// The adaptive strategy re-evaluates the engine after this many operations
+    static constexpr size_t reviewInterval = 64;
+
+    /// ...or as soon as the active engine has had to rebuild its cache this many times
+    static constexpr size_t rebuildsBeforeReview = 2;
+
+    /// Automatic wheels smaller than this always use the linear scan
+    static constexpr size_t minimumAdaptiveSize = 32;
+
+    /// A new engine must be at least this much cheaper (after paying for its build) to switch
+    static constexpr double switchThreshold = 0.75;
+
+    /// Build costs are spread over this many review windows when comparing engines
+    static constexpr double buildAmortizationWindows = 256.0;
+
+    /// Stochastic acceptance hands over to the Fenwick tree below this acceptance rate...
+    static constexpr double minimumAcceptanceRate = 0.1;
+
+    /// ...measured over windows of this many draws
+    static constexpr size_t acceptanceWindow = 256;
+
+    /// A single stochastic acceptance draw gives up after this many rejected candidates
+    static constexpr size_t maximumAcceptanceAttempts = 64;
+
+    /// Masks excluding at most 1/sparseMaskDivisor of a wheel's regions skip them via cumulative weights
+    static constexpr size_t sparseMaskDivisor = 8;
+
+    /// A lazy weight scale outside [1 / limit, limit] is folded into the stored weights
+    static constexpr double weightScaleLimit = 4294967296.0;
+
+    using AliasCache = AliasTable<DoubleAllocator>;
+    using FenwickCache = FenwickTree<W, WeightAllocator>;
+    using BucketCache = BucketedSampler<W, WeightAllocator>;
+
+    /**
+     * @brief Everything the selection engines keep besides the regions, allocated the first
+     *        time a wheel needs any of it. At most one engine's cache exists at a time.
+     */
+    struct EngineState {
+        explicit EngineState(const Allocator& allocator)
+            : prefixSums(WeightAllocator(allocator))
+            , maskedIndices(IndexAllocator(allocator))
+            , transformedSums(DoubleAllocator(allocator)) {
+        }
+
+        // Built on first use by their engine and kept up to date (or invalidated) by the
+        // mutation hooks; switching engines frees the previous engine's cache
+        std::variant<std::monostate, AliasCache, FenwickCache, BucketCache> cache;
+        bool cacheValid = false;
+        size_t updatesSinceBuild = 0;   ///< Floating-point updates applied to cache in place
+        std::vector<W, WeightAllocator> prefixSums; ///< PrefixSum engine's cache, also used by sparse masked draws
+        bool prefixSumsValid = false;
+        W maxWeight = W{0};
+        bool maxWeightValid = false;
+        bool maxWeightLoose = false;    ///< maxWeight is only an upper bound (the max region shrank)
+        size_t acceptanceDraws = 0;     ///< Stochastic acceptance draws in the current window
+        size_t acceptanceAttempts = 0;  ///< Candidates tried for those draws
+        std::vector<size_t, IndexAllocator> maskedIndices; ///< Scratch for masked selection
+        std::vector<double, DoubleAllocator> transformedSums; ///< Cumulative effective weights, used while isTransformed()
+        bool transformedSumsValid = false;
+
+        UsageStats recentUsage;   ///< Operations since the last review
+        UsageStats pastUsage;     ///< Decayed operations from earlier reviews
+        size_t operationsSinceReview = 0;
+        size_t rebuildsSinceReview = 0;
+    };
+
+    /*** Member Variables ***/
+    Options options;
+    std::vector<WheelRegion<E, W>, Allocator> regions;
+    mutable W totalWeight = W{0};
+    mutable bool totalWeightDirty = true;
+    mutable bool uniformWeights = false; ///< All regions share one weight (valid while !totalWeightDirty)
+    mutable Strategy activeStrategy = Strategy::LinearScan;
+
+    // Wheel-level weight transforms: a region's effective weight is
+    // max(0, weight * weightScale + weightOffset) ^ (1 / temperature)
+    double weightScale = 1.0;
+    double weightOffset = 0.0;
+    double temperature = 1.0;
+
+    mutable LazyBox<EngineState, Allocator> engineState; ///< Absent until an engine or the adaptive strategy needs it
+    ElementIndex<E, Allocator> elementIndex; ///< Stale (and empty) unless options.indexElements
+
+    /*** Private Helper Methods ***/
+
+    /**
+     * @brief Calculates the sum of all region weights, noting in the same pass whether
+     *        every region has the same weight
+     * @return Total weight
+     */
+    W calculateTotalWeight() const {
+        if (totalWeightDirty) {
+            totalWeight = W{0};
+            uniformWeights = true;
+            for (const auto& region : regions) {
+                totalWeight += region.getWeight();
+                uniformWeights = uniformWeights && region.getWeight() == regions.front().getWeight();
+            }
+            totalWeightDirty = false;
+        }
+        return totalWeight;
+    }
+
+    /**
+     * @brief Gets the total weight from whichever cache is current, recomputing only if none is
+     * @return Total weight
+     */
+    W currentTotalWeight() const {
+        if (totalWeightDirty) {
+            if (const FenwickCache* tree = validCache<FenwickCache>()) {
+                return tree->getTotal();
+            }
+            if (const BucketCache* buckets = validCache<BucketCache>()) {
+                return buckets->getTotal();
+            }
+        }
+        return calculateTotalWeight();
+    }
+
+    /**
+     * @brief Gets an engine cache if it is the one the wheel holds and it is current
+     * @tparam Cache AliasCache, FenwickCache or BucketCache
+     * @return The cache, or nullptr
+     */
+    template<typename Cache>
+    Cache* validCache() const {
+        EngineState* state = engineState.get();
+        return state != nullptr && state->cacheValid ? std::get_if<Cache>(&state->cache) : nullptr;
+    }
+
+    /**
+     * @brief Gets the storage for an engine cache, replacing any other engine's cache
+     * @tparam Cache AliasCache, FenwickCache or BucketCache
+     * @return The cache, marked invalid until the caller has rebuilt it
+     */
+    template<typename Cache>
+    Cache& cacheToBuild() const {
+        EngineState& state = engineState.getOrCreate();
+        if (!std::holds_alternative<Cache>(state.cache)) {
+            state.cache.template emplace<Cache>(regions.get_allocator());
+        }
+        state.cacheValid = false;
+        return std::get<Cache>(state.cache);
+    }
+
+    /**
+     * @brief Gets the scratch list masked selection collects region indices in
+     * @return The (cleared or stale) list
+     */
+    std::vector<size_t, IndexAllocator>& scratchIndices() const {
+        return engineState.getOrCreate().maskedIndices;
+    }
+
+    /**
+     * @brief Calculates the selection probability of a region
+     * @param index Index of the region (must be valid)
+     * @return Probability fraction (0.0 to 1.0)
+     */
+    double probabilityAt(size_t index) const {
+        if (isTransformed()) {
+            const double total = transformedSums().back();
+            return total <= 0.0 ? 0.0 : transformedWeight(index) / total;
+        }
+
+        const W totalWeight = currentTotalWeight();
+        if (totalWeight <= 0) {
+            return 0.0;
+        }
+        return static_cast<double>(regions[index].getWeight()) / static_cast<double>(totalWeight);
+    }
+
+    /*** Mutation Hooks ***/
+
+    /**
+     * @brief Updates the caches for a region just appended to the wheel
+     * @param weight The new region's weight
+     */
+    void onRegionAppended(W weight) {
+        if (!totalWeightDirty) {
+            totalWeight += weight;
+            uniformWeights = uniformWeights && weight == regions.front().getWeight();
+        }
+        if (EngineState* state = engineState.get()) {
+            if (state->prefixSumsValid) {
+                state->prefixSums.push_back(state->prefixSums.empty() ? weight : state->prefixSums.back() + weight);
+            }
+            if (FenwickCache* tree = validCache<FenwickCache>()) {
+                tree->pushBack(weight);
+            } else if (BucketCache* buckets = validCache<BucketCache>()) {
+                buckets->pushBack(weight);
+            } else {
+                state->cacheValid = false;  // The alias table has no incremental append
+            }
+            if (state->maxWeightValid) {
+                state->maxWeight = std::max(state->maxWeight, weight);
+            }
+            if (state->transformedSumsValid) {
+                const double transformed = transformedWeight(regions.size() - 1);
+                state->transformedSums.push_back(state->transformedSums.empty()
+                    ? transformed : state->transformedSums.back() + transformed);
+            }
+        }
+        elementIndex.onAppend(regions.back().getElement(), regions.size() - 1);
+
+        noteOperation(&UsageStats::appends);
+    }
+
+    /**
+     * @brief Updates the caches after the weight of a region changed in place
+     * @param index Index of the region
+     * @param oldWeight The region's previous weight
+     * @param newWeight The region's new weight
+     */
+    void onWeightChanged(size_t index, W oldWeight, W newWeight) {
+        // Integer totals are exact, so they can always be adjusted; floating-point totals
+        // are recomputed after a decrease so they never drift
+        if (!totalWeightDirty) {
+            if (std::is_integral_v<W> || newWeight > oldWeight) {
+                totalWeight += newWeight - oldWeight;
+            } else {
+                totalWeightDirty = true;
+            }
+            uniformWeights = regions.size() == 1;
+        }
+        if (EngineState* state = engineState.get()) {
+            state->prefixSumsValid = false;
+            state->transformedSumsValid = false;
+            if (FenwickCache* tree = validCache<FenwickCache>()) {
+                tree->add(index, newWeight - oldWeight);
+                if (std::is_floating_point_v<W> && ++state->updatesSinceBuild > regions.size()) {
+                    state->cacheValid = false;
+                }
+            } else if (BucketCache* buckets = validCache<BucketCache>()) {
+                buckets->update(index, oldWeight, newWeight);
+                if (std::is_floating_point_v<W> && ++state->updatesSinceBuild > regions.size()) {
+                    buckets->refreshTotals([this](size_t i) { return regions[i].getWeight(); });
+                    state->updatesSinceBuild = 0;
+                }
+            } else {
+                state->cacheValid = false;
+            }
+            if (state->maxWeightValid) {
+                if (newWeight >= state->maxWeight) {
+                    state->maxWeight = newWeight;
+                } else if (oldWeight == state->maxWeight) {
+                    state->maxWeightLoose = true;  // Still a valid bound; recomputed only if acceptance suffers
+                }
+            }
+        }
+
+        noteOperation(&UsageStats::weightChanges);
+    }
+
+    /**
+     * @brief Updates the caches for a region about to be erased from the wheel (by
+     *        removeErasedRegion, which swaps the last region into its place under swapsOnErase())
+     * @param index Index of the region (its element must still be intact)
+     */
+    void onRegionErased(size_t index) {
+        const size_t last = regions.size() - 1;
+        const W weight = regions[index].getWeight();
+        if (!totalWeightDirty) {
+            if (std::is_integral_v<W>) {
+                totalWeight -= weight;
+            } else {
+                totalWeightDirty = true;
+            }
+        }
+
+        // The Fenwick tree and buckets follow erases that move at most the last region in
+        // O(log n) / O(1); erasing from the middle shifts every later index, so they are rebuilt
+        const bool swapWithLast = swapsOnErase();
+        if (EngineState* state = engineState.get()) {
+            state->prefixSumsValid = false;
+            state->transformedSumsValid = false;
+            const W lastWeight = regions[last].getWeight();
+            if (!swapWithLast && index != last) {
+                state->cacheValid = false;
+            } else if (FenwickCache* tree = validCache<FenwickCache>()) {
+                if (index != last) {
+                    tree->add(index, lastWeight - weight);
+                }
+                tree->popBack(lastWeight);
+                if (std::is_floating_point_v<W> && ++state->updatesSinceBuild > last) {
+                    state->cacheValid = false;
+                }
+            } else if (BucketCache* buckets = validCache<BucketCache>()) {
+                buckets->swapRemove(index, weight);
+                if (std::is_floating_point_v<W> && ++state->updatesSinceBuild > last) {
+                    state->cacheValid = false;
+                }
+            } else {
+                state->cacheValid = false;
+            }
+            if (state->maxWeightValid && weight == state->maxWeight) {
+                state->maxWeightLoose = true;
+            }
+        }
+        if (swapWithLast && index != last) {
+            elementIndex.onSwapErase(regions[index].getElement(), regions[last].getElement(), index, last);
+        } else {
+            elementIndex.onErase(regions[index].getElement(), index, regions.size());
+        }
+
+        noteOperation(&UsageStats::erases);
+    }
+
+    /**
+     * @brief Invalidates every cache after regions were removed or replaced wholesale
+     */
+    void onRegionsRestructured() {
+        invalidateCaches();
+        elementIndex.invalidate();
+    }
+
+    /**
+     * @brief Invalidates every weight-derived cache
+     */
+    void invalidateCaches() {
+        totalWeightDirty = true;
+        if (EngineState* state = engineState.get()) {
+            state->prefixSumsValid = false;
+            state->transformedSumsValid = false;
+            state->cacheValid = false;
+            state->maxWeightValid = false;
+        }
+    }
+
+    /**
+     * @brief Invalidates the cumulative effective weights after a transform changed
+     */
+    void invalidateTransformedSums() {
+        if (EngineState* state = engineState.get()) {
+            state->transformedSumsValid = false;
+        }
+    }
+
+    /*** Selection Engines ***/
+
+    /**
+     * @brief Picks the index of a region using weighted random selection
+     * @return Index into regions of the selected region
+     * @throws std::runtime_error if the wheel is empty
+     */
+    size_t selectIndex() const {
+        noteRead();
+        return selectIndexWithActiveEngine();
+    }
+
+    /**
+     * @brief Counts a selection towards the adaptive strategy
+     * @throws std::runtime_error if the wheel is empty
+     */
+    void noteRead() const {
+        if (regions.empty()) {
+            throw std::runtime_error(
+                "RouletteWheel::select: wheel is empty — either it was constructed with no entries, "
+                "all entries had weight <= 0 (use Options{.ignoreInvalidWeights=true} to skip them), "
+                "or all elements were removed");
+        }
+
+        noteOperation(&UsageStats::reads);
+    }
+
+    /**
+     * @brief Picks the index of a region with the active engine (the wheel must not be empty)
+     * @return Index into regions of the selected region
+     */
+    size_t selectIndexWithActiveEngine() const {
+        if (isTransformed()) {
+            return selectTransformedIndex();
+        }
+        if (regions.size() == 1) {
+            return 0;
+        }
+
+        switch (activeStrategy) {
+            case Strategy::PrefixSum:
+                return selectIndexByPrefixSum();
+            case Strategy::AliasTable:
+                return selectIndexByAliasTable();
+            case Strategy::FenwickTree:
+                return selectIndexByFenwickTree();
+            case Strategy::StochasticAcceptance:
+                return selectIndexByAcceptance();
+            case Strategy::PowerOfTwoBuckets:
+                return selectIndexByBuckets();
+            default:
+                return selectIndexByScan();
+        }
+    }
+
+    /**
+     * @brief Picks the index of a region among those a mask leaves enabled
+     * @param enabled One flag per region; false excludes the region
+     * @return Index into regions of the selected region
+     * @throws std::invalid_argument if the mask's size differs from the number of regions
+     * @throws std::runtime_error if the wheel is empty or the mask enables no region
+     */
+    size_t selectMaskedIndex(const std::vector<bool>& enabled) const {
+        if (enabled.size() != regions.size()) {
+            std::ostringstream msg;
+            msg << "RouletteWheel::select: mask has " << enabled.size() << " flags for "
+                << regions.size() << " regions";
+            throw std::invalid_argument(msg.str());
+        }
+        noteRead();
+
+        if (isTransformed()) {
+            return selectTransformedIndexWhere([&enabled](size_t i) { return enabled[i]; });
+        }
+
+        // One pass over the mask gathers what either path needs: the excluded indices (only
+        // while the mask stays sparse) and the enabled weight
+        std::vector<size_t, IndexAllocator>& maskedIndices = scratchIndices();
+        maskedIndices.clear();
+        size_t excludedCount = 0;
+        W enabledWeight = W{0};
+        for (size_t i = 0; i < enabled.size(); ++i) {
+            if (enabled[i]) {
+                enabledWeight += regions[i].getWeight();
+            } else if (++excludedCount <= sparseExclusionLimit()) {
+                maskedIndices.push_back(i);
+            }
+        }
+
+        if (excludedCount == regions.size()) {
+            throw std::runtime_error("RouletteWheel::select: the mask enables no region");
+        }
+        if (excludedCount == 0) {
+            return selectIndexWithActiveEngine();
+        }
+        if (excludedCount <= sparseExclusionLimit()) {
+            return selectIndexExcluding([&enabled](size_t i) { return enabled[i]; });
+        }
+        return selectIndexWhere([&enabled](size_t i) { return enabled[i]; }, enabledWeight);
+    }
+
+    /**
+     * @brief Gets the most regions a selection can exclude and still skip them via cumulative
+     *        weights rather than a pass over every region
+     * @return The sparse-path limit (0 for wheels small enough to always scan)
+     */
+    size_t sparseExclusionLimit() const {
+        return regions.size() < minimumAdaptiveSize ? 0 : regions.size() / sparseMaskDivisor;
+    }
+
+    /**
+     * @brief Sparse path: draws over the total weight minus the excluded weights, then shifts
+     *        the draw past every excluded region that starts at or before it and searches the
+     *        cached cumulative weights (the Fenwick tree if current, else the prefix sums).
+     *        Costs O(excluded + log n) once the cumulative weights are cached.
+     * @param isEnabled Callable returning false for the regions listed in maskedIndices
+     * @return Index of the selected region
+     * @note maskedIndices must hold the excluded indices in ascending order
+     */
+    template<typename IsEnabled>
+    size_t selectIndexExcluding(IsEnabled isEnabled) const {
+        const FenwickCache* fenwickTree = validCache<FenwickCache>();
+        const bool useFenwickTree = fenwickTree != nullptr;
+        const std::vector<W, WeightAllocator>* prefixSums = useFenwickTree ? nullptr : &cumulativeWeights();
+        const std::vector<size_t, IndexAllocator>& maskedIndices = scratchIndices();
+
+        W excludedWeight = W{0};
+        for (const size_t excluded : maskedIndices) {
+            excludedWeight += regions[excluded].getWeight();
+        }
+        const W remainingWeight = (useFenwickTree ? fenwickTree->getTotal() : prefixSums->back()) - excludedWeight;
+        if (remainingWeight <= 0) {
+            return selectIndexWhere(isEnabled);
+        }
+
+        W target = WheelRandom::weightBelow(remainingWeight);
+        for (const size_t excluded : maskedIndices) {
+            const W excludedStart = useFenwickTree ? fenwickTree->prefixSum(excluded)
+                                                   : (excluded == 0 ? W{0} : (*prefixSums)[excluded - 1]);
+            if (target < excludedStart) {
+                break;
+            }
+            target += regions[excluded].getWeight();
+        }
+
+        size_t index = regions.size() - 1;
+        if (useFenwickTree) {
+            index = fenwickTree->find(target);
+        } else {
+            const auto found = std::upper_bound(prefixSums->begin(), prefixSums->end(), target);
+            index = std::min(static_cast<size_t>(found - prefixSums->begin()), index);
+        }
+
+        // Floating-point rounding can land the shifted draw on an excluded neighbour
+        if (!isEnabled(index)) {
+            return selectIndexWhere(isEnabled);
+        }
+        return index;
+    }
+
+    /**
+     * @brief Dense path: sums the enabled weights, then scans for the drawn one
+     * @param isEnabled Callable returning true for selectable region indices (at least one)
+     * @return Index of the selected region
+     */
+    template<typename IsEnabled>
+    size_t selectIndexWhere(IsEnabled isEnabled) const {
+        W enabledWeight = W{0};
+        for (size_t i = 0; i < regions.size(); ++i) {
+            enabledWeight += isEnabled(i) ? regions[i].getWeight() : W{0};
+        }
+        return selectIndexWhere(isEnabled, enabledWeight);
+    }
+
+    /**
+     * @brief Dense path with the enabled weight already known: scans for the drawn region
+     * @param isEnabled Callable returning true for selectable region indices (at least one)
+     * @param enabledWeight Sum of the enabled regions' weights
+     * @return Index of the selected region
+     */
+    template<typename IsEnabled>
+    size_t selectIndexWhere(IsEnabled isEnabled, W enabledWeight) const {
+        // Excluded regions contribute zero weight, which keeps the loop free of mask branches
+        const W randomValue = WheelRandom::weightBelow(enabledWeight);
+        W accumulatedWeight = W{0};
+        size_t lastEnabled = 0;
+        for (size_t i = 0; i < regions.size(); ++i) {
+            const bool enabled = isEnabled(i);
+            accumulatedWeight += enabled ? regions[i].getWeight() : W{0};
+            lastEnabled = enabled ? i : lastEnabled;
+            if (accumulatedWeight > randomValue) {
+                return i;
+            }
+        }
+        return lastEnabled;
+    }
+
+    /**
+     * @brief Weighted draw restricted to a list of regions
+     * @param candidates Non-empty list of region indices
+     * @return The selected index from candidates
+     */
+    template<typename IndexList>
+    size_t selectIndexAmong(const IndexList& candidates) const {
+        W candidateTotal = W{0};
+        for (const size_t index : candidates) {
+            candidateTotal += regions[index].getWeight();
+        }
+
+        const W randomValue = WheelRandom::weightBelow(candidateTotal);
+        W accumulatedWeight = W{0};
+        for (const size_t index : candidates) {
+            accumulatedWeight += regions[index].getWeight();
+            if (accumulatedWeight > randomValue) {
+                return index;
+            }
+        }
+        return candidates.back();
+    }
+
+    /**
+     * @brief Checks whether an offset or temperature reshapes the weights (a scale alone
+     *        leaves the distribution unchanged, so the engines ignore it)
+     * @return true if selection must use the effective weights
+     */
+    bool isTransformed() const {
+        return weightOffset != 0.0 || temperature != 1.0;
+    }
+
+    /**
+     * @brief Computes a region's effective weight under the wheel's transforms
+     * @param index Index of the region
+     * @return max(0, weight * weightScale + weightOffset) ^ (1 / temperature)
+     */
+    double transformedWeight(size_t index) const {
+        const double shifted = static_cast<double>(regions[index].getWeight()) * weightScale + weightOffset;
+        if (shifted <= 0.0) {
+            return 0.0;
+        }
+        return temperature == 1.0 ? shifted : std::pow(shifted, 1.0 / temperature);
+    }
+
+    /**
+     * @brief Gets the cumulative effective weights, rebuilding them if a mutation or transform
+     *        change invalidated them
+     * @return One running total per region
+     */
+    const std::vector<double, DoubleAllocator>& transformedSums() const {
+        EngineState& state = engineState.getOrCreate();
+        if (!state.transformedSumsValid) {
+            state.transformedSums.resize(regions.size());
+            double runningTotal = 0.0;
+            for (size_t i = 0; i < regions.size(); ++i) {
+                runningTotal += transformedWeight(i);
+                state.transformedSums[i] = runningTotal;
+            }
+            state.transformedSumsValid = true;
+        }
+        return state.transformedSums;
+    }
+
+    /**
+     * @brief Transformed engine: binary search over the cumulative effective weights
+     * @return Index of the selected region
+     * @throws std::runtime_error if every effective weight is zero
+     */
+    size_t selectTransformedIndex() const {
+        const std::vector<double, DoubleAllocator>& transformedSums = this->transformedSums();
+        if (transformedSums.back() <= 0.0) {
+            throw std::runtime_error("RouletteWheel::select: the weight offset leaves no region with positive weight");
+        }
+
+        const double randomValue = WheelRandom::weightBelow(transformedSums.back());
+        const auto found = std::upper_bound(transformedSums.begin(), transformedSums.end(), randomValue);
+        return std::min(static_cast<size_t>(found - transformedSums.begin()), regions.size() - 1);
+    }
+
+    /**
+     * @brief Draws among the enabled regions by effective weight
+     * @param isEnabled Callable returning true for selectable region indices
+     * @return Index of the selected region
+     * @throws std::runtime_error if no enabled region has a positive effective weight
+     */
+    template<typename IsEnabled>
+    size_t selectTransformedIndexWhere(IsEnabled isEnabled) const {
+        double enabledWeight = 0.0;
+        for (size_t i = 0; i < regions.size(); ++i) {
+            enabledWeight += isEnabled(i) ? transformedWeight(i) : 0.0;
+        }
+        if (enabledWeight <= 0.0) {
+            throw std::runtime_error("RouletteWheel::select: no enabled region has positive weight");
+        }
+
+        const double randomValue = WheelRandom::weightBelow(enabledWeight);
+        double accumulatedWeight = 0.0;
+        size_t lastEnabled = 0;
+        for (size_t i = 0; i < regions.size(); ++i) {
+            if (isEnabled(i) && transformedWeight(i) > 0.0) {
+                accumulatedWeight += transformedWeight(i);
+                lastEnabled = i;
+                if (accumulatedWeight > randomValue) {
+                    return i;
+                }
+            }
+        }
+        return lastEnabled;
+    }
+
+    /**
+     * @brief Linear scan engine
+     * @return Index of the selected region
+     */
+    size_t selectIndexByScan() const {
+        const W totalWeight = calculateTotalWeight();
+
+        // Equal weights make every region equally likely: one bounded index draw, no scan
+        if (uniformWeights) {
+            return WheelRandom::indexBelow(regions.size());
+        }
+
+        return WheelRandom::indexByWeight(regions.size(),
+            [this](size_t i) { return regions[i].getWeight(); }, totalWeight);
+    }
+
+    /**
+     * @brief Prefix sum engine: binary search over cached cumulative weights
+     * @return Index of the selected region
+     */
+    size_t selectIndexByPrefixSum() const {
+        const std::vector<W, WeightAllocator>& prefixSums = cumulativeWeights();
+        if (uniformWeights) {
+            return WheelRandom::indexBelow(regions.size());
+        }
+
+        const W randomValue = WheelRandom::weightBelow(prefixSums.back());
+        const auto found = std::upper_bound(prefixSums.begin(), prefixSums.end(), randomValue);
+        return std::min(static_cast<size_t>(found - prefixSums.begin()), regions.size() - 1);
+    }
+
+    /**
+     * @brief Alias table engine: one draw and one table lookup
+     * @return Index of the selected region
+     */
+    size_t selectIndexByAliasTable() const {
+        return aliasTable().sample();
+    }
+
+    /**
+     * @brief Fenwick tree engine: O(log n) descent over partial sums
+     * @return Index of the selected region
+     */
+    size_t selectIndexByFenwickTree() const {
+        const FenwickCache& tree = fenwickTree();
+        return tree.find(WheelRandom::weightBelow(tree.getTotal()));
+    }
+
+    /**
+     * @brief Power-of-two bucket engine: pick a weight scale, then a region within it by rejection
+     * @return Index of the selected region
+     */
+    size_t selectIndexByBuckets() const {
+        return bucketedSampler().sample([this](size_t i) { return regions[i].getWeight(); });
+    }
+
+    /**
+     * @brief Stochastic acceptance engine: draw a uniform candidate and keep it with probability
+     *        weight / maxWeight. Expected attempts are n * maxWeight / totalWeight.
+     * @return Index of the selected region
+     */
+    size_t selectIndexByAcceptance() const {
+        const W maxWeight = maximumWeight();
+        for (size_t attempt = 1; attempt <= maximumAcceptanceAttempts; ++attempt) {
+            const size_t candidate = WheelRandom::indexBelow(regions.size());
+            if (WheelRandom::weightBelow(maxWeight) < regions[candidate].getWeight()) {
+                noteAcceptance(attempt);
+                return candidate;
+            }
+        }
+
+        // Too skewed for rejection sampling: finish this draw (and the next ones) on the tree
+        noteAcceptance(maximumAcceptanceAttempts);
+        switchStrategy(Strategy::FenwickTree);
+        return selectIndexByFenwickTree();
+    }
+
+    /**
+     * @brief Records how many candidates a stochastic acceptance draw needed and, once per
+     *        window, tightens a loose max weight or hands over to the Fenwick tree when the
+     *        acceptance rate is too low
+     * @param attempts Candidates tried for the draw
+     */
+    void noteAcceptance(size_t attempts) const {
+        EngineState& state = engineState.getOrCreate();
+        ++state.acceptanceDraws;
+        state.acceptanceAttempts += attempts;
+        if (state.acceptanceDraws < acceptanceWindow) {
+            return;
+        }
+
+        const double acceptanceRate = static_cast<double>(state.acceptanceDraws)
+            / static_cast<double>(state.acceptanceAttempts);
+        state.acceptanceDraws = 0;
+        state.acceptanceAttempts = 0;
+        if (acceptanceRate >= minimumAcceptanceRate) {
+            return;
+        }
+        if (state.maxWeightLoose) {
+            recomputeMaxWeight();
+            return;
+        }
+        switchStrategy(Strategy::FenwickTree);
+    }
+
+    /**
+     * @brief While a pinned stochastic acceptance wheel runs on its fallback engine, returns
+     *        to rejection sampling once the expected acceptance rate has clearly recovered
+     */
+    void reviewAcceptanceFallback() const {
+        if (regions.empty()) {
+            return;
+        }
+        EngineState& state = engineState.getOrCreate();
+        if (!state.maxWeightValid || state.maxWeightLoose) {
+            recomputeMaxWeight();
+        }
+        const double expectedRate = static_cast<double>(currentTotalWeight())
+            / (static_cast<double>(regions.size()) * static_cast<double>(state.maxWeight));
+        if (expectedRate >= 2.0 * minimumAcceptanceRate) {
+            state.acceptanceDraws = 0;
+            state.acceptanceAttempts = 0;
+            switchStrategy(Strategy::StochasticAcceptance);
+        }
+    }
+
+    /**
+     * @brief Recomputes the exact maximum region weight
+     */
+    void recomputeMaxWeight() const {
+        EngineState& state = engineState.getOrCreate();
+        state.maxWeight = W{0};
+        for (const auto& region : regions) {
+            state.maxWeight = std::max(state.maxWeight, region.getWeight());
+        }
+        state.maxWeightValid = true;
+        state.maxWeightLoose = false;
+    }
+
+    /**
+     * @brief Gets the stochastic acceptance bound, computing it if needed
+     * @return The maximum region weight (or an upper bound on it)
+     */
+    W maximumWeight() const {
+        const EngineState* state = engineState.get();
+        if (state == nullptr || !state->maxWeightValid) {
+            recomputeMaxWeight();
+        }
+        return engineState.get()->maxWeight;
+    }
+
+    /**
+     * @brief Gets the cumulative weights, rebuilding them (and refreshing the total and
+     *        uniformity in the same pass) if needed
+     * @return One running total per region
+     */
+    const std::vector<W, WeightAllocator>& cumulativeWeights() const {
+        EngineState& state = engineState.getOrCreate();
+        if (state.prefixSumsValid) {
+            return state.prefixSums;
+        }
+        state.prefixSums.resize(regions.size());
+        W runningTotal = W{0};
+        uniformWeights = true;
+        for (size_t i = 0; i < regions.size(); ++i) {
+            runningTotal += regions[i].getWeight();
+            state.prefixSums[i] = runningTotal;
+            uniformWeights = uniformWeights && regions[i].getWeight() == regions.front().getWeight();
+        }
+        totalWeight = runningTotal;
+        totalWeightDirty = false;
+        state.prefixSumsValid = true;
+        ++state.rebuildsSinceReview;
+        return state.prefixSums;
+    }
+
+    /**
+     * @brief Gets the alias table, rebuilding it if needed
+     * @return The current alias table
+     */
+    const AliasCache& aliasTable() const {
+        if (const AliasCache* table = validCache<AliasCache>()) {
+            return *table;
+        }
+        AliasCache& table = cacheToBuild<AliasCache>();
+        table.build(regions.size(),
+            [this](size_t i) { return static_cast<double>(regions[i].getWeight()); },
+            static_cast<double>(calculateTotalWeight()));
+        markCacheBuilt();
+        return table;
+    }
+
+    /**
+     * @brief Gets the Fenwick tree, rebuilding it if needed
+     * @return The current Fenwick tree
+     */
+    const FenwickCache& fenwickTree() const {
+        if (const FenwickCache* tree = validCache<FenwickCache>()) {
+            return *tree;
+        }
+        FenwickCache& tree = cacheToBuild<FenwickCache>();
+        tree.build(regions.size(), [this](size_t i) { return regions[i].getWeight(); });
+        markCacheBuilt();
+        return tree;
+    }
+
+    /**
+     * @brief Gets the power-of-two buckets, rebuilding them if needed
+     * @return The current buckets
+     */
+    const BucketCache& bucketedSampler() const {
+        if (const BucketCache* buckets = validCache<BucketCache>()) {
+            return *buckets;
+        }
+        BucketCache& buckets = cacheToBuild<BucketCache>();
+        buckets.build(regions.size(), [this](size_t i) { return regions[i].getWeight(); });
+        markCacheBuilt();
+        return buckets;
+    }
+
+    /**
+     * @brief Records that the engine cache was just rebuilt from the regions
+     */
+    void markCacheBuilt() const {
+        EngineState& state = *engineState.get();
+        state.cacheValid = true;
+        state.updatesSinceBuild = 0;
+        ++state.rebuildsSinceReview;
+    }
+
+    /**
+     * @brief Builds the total weight and the active engine's cache ahead of the next draw
+     */
+    void warmActiveEngine() const {
+        if (regions.empty()) {
+            return;
+        }
+        calculateTotalWeight();
+        switch (activeStrategy) {
+            case Strategy::PrefixSum:
+                cumulativeWeights();
+                break;
+            case Strategy::AliasTable:
+                aliasTable();
+                break;
+            case Strategy::FenwickTree:
+                fenwickTree();
+                break;
+            case Strategy::PowerOfTwoBuckets:
+                bucketedSampler();
+                break;
+            case Strategy::StochasticAcceptance:
+                maximumWeight();
+                break;
+            default:
+                break;
+        }
+    }
+
+    /*** Adaptive Strategy ***/
+
+    /**
+     * @brief Chooses the engine a wheel starts with
+     * @param strategy The configured strategy
+     * @return The pinned engine, or the linear scan for automatic wheels
+     */
+    static Strategy initialStrategy(Strategy strategy) {
+        return strategy == Strategy::Automatic ? Strategy::LinearScan : strategy;
+    }
+
+    /**
+     * @brief Counts an operation and re-evaluates the engine every reviewInterval operations
+     *        (or sooner when the active engine keeps rebuilding its cache). Pinned stochastic
+     *        acceptance wheels use the same interval to check whether they can leave their fallback.
+     * @param kind The UsageStats counter the operation belongs to
+     */
+    void noteOperation(double UsageStats::*kind) const {
+        UsageStats operations;
+        operations.*kind = 1.0;
+        noteOperations(operations);
+    }
+
+    /**
+     * @brief Counts several operations as one (see noteOperation). Automatic wheels below
+     *        minimumAdaptiveSize that are still scanning record nothing, so they never
+     *        allocate engine state.
+     * @param operations The operations to count
+     */
+    void noteOperations(const UsageStats& operations) const {
+        if (options.strategy == Strategy::StochasticAcceptance) {
+            if (activeStrategy != Strategy::StochasticAcceptance
+                && ++engineState.getOrCreate().operationsSinceReview >= reviewInterval) {
+                engineState.get()->operationsSinceReview = 0;
+                reviewAcceptanceFallback();
+            }
+            return;
+        }
+        if (options.strategy != Strategy::Automatic
+            || (activeStrategy == Strategy::LinearScan && regions.size() < minimumAdaptiveSize)) {
+            return;
+        }
+
+        EngineState& state = engineState.getOrCreate();
+        state.recentUsage.reads += operations.reads;
+        state.recentUsage.weightChanges += operations.weightChanges;
+        state.recentUsage.appends += operations.appends;
+        state.recentUsage.erases += operations.erases;
+        // Rebuilds are the expensive mistake, so a burst of them is reviewed immediately
+        if (++state.operationsSinceReview < reviewInterval && state.rebuildsSinceReview < rebuildsBeforeReview) {
+            return;
+        }
+        reviewStrategy();
+    }
+
+    /**
+     * @brief Folds the latest operations into the usage history and switches to a cheaper
+     *        engine when it beats the current one by a clear margin
+     */
+    void reviewStrategy() const {
+        EngineState& state = *engineState.get();
+        state.operationsSinceReview = 0;
+        state.rebuildsSinceReview = 0;
+        state.pastUsage.reads = state.pastUsage.reads / 2 + state.recentUsage.reads;
+        state.pastUsage.weightChanges = state.pastUsage.weightChanges / 2 + state.recentUsage.weightChanges;
+        state.pastUsage.appends = state.pastUsage.appends / 2 + state.recentUsage.appends;
+        state.pastUsage.erases = state.pastUsage.erases / 2 + state.recentUsage.erases;
+        state.recentUsage = UsageStats{};
+
+        if (regions.size() < minimumAdaptiveSize) {
+            switchStrategy(Strategy::LinearScan);
+            return;
+        }
+
+        constexpr std::array<Strategy, 4> engines = {
+            Strategy::LinearScan, Strategy::PrefixSum, Strategy::AliasTable, Strategy::FenwickTree
+        };
+        const double currentCost = estimateCost(activeStrategy);
+        Strategy cheapest = activeStrategy;
+        double cheapestCost = currentCost;
+        for (const Strategy engine : engines) {
+            if (engine == activeStrategy) {
+                continue;
+            }
+            // Hysteresis: the new engine must pay for its build and still clearly win
+            const double cost = estimateCost(engine) + estimateBuildCost(engine) / buildAmortizationWindows;
+            if (cost < switchThreshold * currentCost && cost < cheapestCost) {
+                cheapest = engine;
+                cheapestCost = cost;
+            }
+        }
+        // Keeping the current engine keeps any caches masked selection has built alongside it
+        if (cheapest != activeStrategy) {
+            switchStrategy(cheapest);
+        }
+    }
+
+    /**
+     * @brief Estimates the cost of the recent workload under an engine. Units are roughly
+     *        nanoseconds; the per-region factors were measured with benchmark_strategies.cpp
+     *        (a scan step is far cheaper than a binary search or tree step, which miss cache,
+     *        and an alias table build costs several times a prefix sum build)
+     * @param engine The engine to estimate
+     * @return Estimated cost
+     */
+    double estimateCost(Strategy engine) const {
+        const double n = static_cast<double>(regions.size());
+        const double logN = std::log2(n) + 1.0;
+        const UsageStats& usage = engineState.get()->pastUsage;
+
+        // Several edits between two reads share one rebuild
+        const auto rebuilds = [&usage](double edits) {
+            return std::min(edits, usage.reads + 1.0);
+        };
+
+        switch (engine) {
+            case Strategy::PrefixSum:
+                return usage.reads * 3.0 * logN
+                     + rebuilds(usage.weightChanges + usage.erases) * estimateBuildCost(engine)
+                     + usage.appends;
+            case Strategy::AliasTable:
+                return usage.reads * 15.0
+                     + rebuilds(usage.weightChanges + usage.erases + usage.appends) * estimateBuildCost(engine);
+            case Strategy::FenwickTree:
+                return usage.reads * 4.0 * logN
+                     + usage.weightChanges * 3.0 * logN
+                     + rebuilds(usage.erases) * estimateBuildCost(engine)
+                     + usage.appends * logN;
+            default: {
+                const double totalRefreshes = std::is_floating_point_v<W>
+                    ? rebuilds(usage.weightChanges + usage.erases) * n * 0.25
+                    : 0.0;
+                return usage.reads * n * 0.5 * 0.25 + totalRefreshes;
+            }
+        }
+    }
+
+    /**
+     * @brief Estimates the one-off cost of building an engine's cache (same units as estimateCost)
+     * @param engine The engine to estimate
+     * @return Estimated cost
+     */
+    double estimateBuildCost(Strategy engine) const {
+        const double n = static_cast<double>(regions.size());
+        switch (engine) {
+            case Strategy::PrefixSum:
+            case Strategy::FenwickTree:
+                return 2.0 * n;
+            case Strategy::AliasTable:
+                return 10.0 * n;
+            default:
+                return 0.0;
+        }
+    }
+
+    /**
+     * @brief Makes an engine active, dropping the caches other engines would have to maintain
+     * @param engine The engine to activate
+     */
+    void switchStrategy(Strategy engine) const {
+        activeStrategy = engine;
+        EngineState* state = engineState.get();
+        if (state == nullptr) {
+            return;
+        }
+        state->prefixSumsValid = state->prefixSumsValid && engine == Strategy::PrefixSum;
+        const bool cacheBelongsToEngine = (engine == Strategy::AliasTable && std::holds_alternative<AliasCache>(state->cache))
+            || (engine == Strategy::FenwickTree && std::holds_alternative<FenwickCache>(state->cache))
+            || (engine == Strategy::PowerOfTwoBuckets && std::holds_alternative<BucketCache>(state->cache));
+        if (!cacheBelongsToEngine) {
+            state->cache = std::monostate{};
+            state->cacheValid = false;
+        }
+    }
+
+    /*** Region Helpers ***/
+
+    /**
+     * @brief Moves the element at the given index out of the wheel and erases its region
+     * @param index Index of the region to remove
+     * @return The removed element
+     */
+    E extractRegionAt(size_t index) {
+        onRegionErased(index);
+        E element = regions[index].extractElement();
+        removeErasedRegion(index);
+        return element;
+    }
+
+    /**
+     * @brief Erases the region at the given index, updating the caches
+     * @param index Index of the region to remove
+     */
+    void eraseRegionAt(size_t index) {
+        onRegionErased(index);
+        removeErasedRegion(index);
+    }
+
+    /**
+     * @brief Removes a region whose erase onRegionErased has already recorded
+     * @param index Index of the region
+     */
+    void removeErasedRegion(size_t index) {
+        if (swapsOnErase() && index + 1 != regions.size()) {
+            regions[index] = std::move(regions.back());
+            regions.pop_back();
+        } else {
+            regions.erase(regions.begin() + index);
+        }
+    }
+
+    /**
+     * @brief Checks whether erasing a region moves the last region into its place instead of
+     *        shifting every later region, which keeps the erase O(1) for the bucketed engine
+     * @return true for wheels pinned to PowerOfTwoBuckets
+     */
+    bool swapsOnErase() const {
+        return options.strategy == Strategy::PowerOfTwoBuckets;
+    }
+
+    /**
+     * @brief Throws if a weight is not usable for a new region
+     * @param weight The weight to validate
+     * @param caller Name of the calling method, used in the error message
+     * @throws std::invalid_argument if weight is negative or zero
+     */
+    static void validateWeight(W weight, const char* caller) {
+        if (weight <= 0) {
+            std::ostringstream msg;
+            msg << "RouletteWheel::" << caller << ": weight must be positive, got " << weight
+                << " (use Options{.ignoreInvalidWeights=true} in the constructor to skip such entries)";
+            throw std::invalid_argument(msg.str());
+        }
+    }
+
+    /**
+     * @brief Throws if an index does not name a region
+     * @param index The index to validate
+     * @param caller Name of the calling method, used in the error message
+     * @throws std::out_of_range if index is not less than size()
+     */
+    void validateIndex(size_t index, const char* caller) const {
+        if (index >= regions.size()) {
+            std::ostringstream msg;
+            msg << "RouletteWheel::" << caller << ": index " << index
+                << " is out of range for " << regions.size() << " regions";
+            throw std::out_of_range(msg.str());
+        }
+    }
+
+    /**
+     * @brief Throws if a transform parameter is not a positive, finite number
+     * @param value The parameter
+     * @param caller Name of the calling method, used in the error message
+     * @throws std::invalid_argument if value is not positive and finite
+     */
+    static void validateTransformParameter(double value, const char* caller) {
+        if (!(value > 0.0) || !std::isfinite(value)) {
+            std::ostringstream msg;
+            msg << "RouletteWheel::" << caller << ": value must be positive and finite, got " << value;
+            throw std::invalid_argument(msg.str());
+        }
+    }
+
+    /**
+     * @brief Converts a weight given in scaled units (see scaleWeights) to stored units
+     * @param weight The weight or weight delta
+     * @return The value to store
+     */
+    W toStoredWeight(W weight) const {
+        if constexpr (std::is_floating_point_v<W>) {
+            return weightScale == 1.0 ? weight : static_cast<W>(weight / weightScale);
+        } else {
+            return weight;
+        }
+    }
+
+    /**
+     * @brief Applies the lazy weight scale to every stored weight in O(n) and resets it to 1
+     */
+    void foldWeightScale() {
+        for (auto& region : regions) {
+            region.setWeight(static_cast<W>(region.getWeight() * weightScale));
+        }
+        weightScale = 1.0;
+        onRegionsRestructured();
+    }
+
+    /**
+     * @brief Finds the index of an element in the regions vector
+     * @param element The element to find
+     * @param searchEnd Only regions before this index are searched
+     * @return Optional containing the index, or nullopt if not found
+     */
+    std::optional<size_t> findElementIndex(const E& element, size_t searchEnd = SIZE_MAX) const {
+        if (options.indexElements) {
+            return elementIndex.find(element, regions, searchEnd);
+        }
+        const size_t end = std::min(searchEnd, regions.size());
+        for (size_t i = 0; i < end; ++i) {
+            if (regions[i].getElement() == element) {
+                return i;
+            }
+        }
+        return std::nullopt;
+    }
+
+    /**
+     * @brief Combines weight to an existing region at the specified index
+     * @param index Index of the region
+     * @param additionalWeight Weight to add
+     */
+    void combineWeightAtIndex(size_t index, W additionalWeight) {
+        replaceWeightAtIndex(index, regions[index].getWeight() + additionalWeight);
+    }
+
+    /**
+     * @brief Overwrites the stored weight of a region and updates the caches
+     * @param index Index of the region
+     * @param newWeight The new stored weight
+     */
+    void replaceWeightAtIndex(size_t index, W newWeight) {
+        const W oldWeight = regions[index].getWeight();
+        regions[index].setWeight(newWeight);
+        onWeightChanged(index, oldWeight, newWeight);
+    }
+
+    /**
+     * @brief Adds a delta (in scaled units) to a region's weight, erasing the region if the
+     *        weight is no longer positive
+     * @param index Index of the region
+     * @param weightDelta Amount to add
+     */
+    void adjustWeightAtIndex(size_t index, W weightDelta) {
+        const W newWeight = regions[index].getWeight() + toStoredWeight(weightDelta);
+        if (newWeight <= 0) {
+            eraseRegionAt(index);
+            return;
+        }
+        replaceWeightAtIndex(index, newWeight);
     }
 
 #ifdef USE_CEREAL
     friend class cereal::access;
 
     /**
-     * @brief Serialization function for the cereal library
+     * @brief Save function for the cereal library
      *
-     * Allows the RouletteWheel object to be serialized/deserialized.
+     * Saves the regions, exactly as wheels always have. With Options::serializeCaches, a
+     * trailing block follows them: the weight transforms, the active engine with its cache
+     * (built first if needed) and a fingerprint of the weights the cache was built from.
      * Requires that both E and W types also have serialization support.
      * Note: Random engine state is not serialized.
      *
+     * @throws std::runtime_error if a weight scale, offset or temperature is set but
+     *         Options::serializeCaches is not (the regions alone cannot hold them)
+     * @see https://github.com/USCiLab/cereal
+     */
+    template <class Archive>
+    void save(Archive& archive) const {
+        if (!options.serializeCaches && (weightScale != 1.0 || isTransformed())) {
+            throw std::runtime_error("RouletteWheel::save: weight transforms are only saved with "
+                                     "Options::serializeCaches");
+        }
+        archive(regions);
+        if (!options.serializeCaches) {
+            return;
+        }
+
+        warmActiveEngine();
+        const auto engine = static_cast<std::uint8_t>(activeStrategy);
+        archive(weightScale, weightOffset, temperature, weightFingerprint(), engine, totalWeight, uniformWeights);
+        switch (activeStrategy) {
+            case Strategy::PrefixSum:
+                archive(cumulativeWeights());
+                break;
+            case Strategy::AliasTable:
+                archive(aliasTable());
+                break;
+            case Strategy::FenwickTree:
+                archive(fenwickTree());
+                break;
+            default:
+                break;
+        }
+    }
+
+    /**
+     * @brief Load function for the cereal library
+     *
+     * Restores the regions and, when the loading wheel sets Options::serializeCaches, reads
+     * the trailing block written by a wheel that set it too; otherwise the archive holds only
+     * the regions, as every archive did before the block existed. Like any other change,
+     * loading leaves the caches to be rebuilt lazily by the first draw, with one exception:
+     * when the block's cache is missing or rejected, the active engine is rebuilt here, so the
+     * first draw does no rebuild. Caches are rejected when the saved engine byte is not a
+     * concrete engine, when the wheel's options do not allow that engine, or when the saved
+     * weight fingerprint does not match the loaded weights. Accepted caches are used as they
+     * are, at the cost of one pass to fingerprint the weights.
+     *
      * @see https://github.com/USCiLab/cereal
      */
     template <class Archive>
-    void serialize(Archive& archive) {
+    void load(Archive& archive) {
+        weightScale = 1.0;
+        weightOffset = 0.0;
+        temperature = 1.0;
         archive(regions);
+        onRegionsRestructured();
+        if (!options.serializeCaches) {
+            return;
+        }
+
+        std::uint64_t fingerprint = 0;
+        std::uint8_t engine = 0;
+        W savedTotal = W{0};
+        bool savedUniform = false;
+        archive(weightScale, weightOffset, temperature, fingerprint, engine, savedTotal, savedUniform);
+
+        const std::optional<Strategy> savedStrategy = concreteEngine(engine);
+        const bool engineAllowed = savedStrategy.has_value()
+            && (options.strategy == *savedStrategy
+                || (options.strategy == Strategy::Automatic && *savedStrategy != Strategy::StochasticAcceptance));
+        if (engineAllowed) {
+            switchStrategy(*savedStrategy);
+        }
+
+        // A cache is read into the slot its engine uses; a rejected one is dropped below
+        bool cacheLoaded = false;
+        switch (savedStrategy.value_or(Strategy::Automatic)) {
+            case Strategy::PrefixSum: {
+                std::vector<W, WeightAllocator>& prefixSums = engineState.getOrCreate().prefixSums;
+                archive(prefixSums);
+                cacheLoaded = prefixSums.size() == regions.size();
+                break;
+            }
+            case Strategy::AliasTable: {
+                AliasCache& table = cacheToBuild<AliasCache>();
+                archive(table);
+                cacheLoaded = table.size() == regions.size();
+                break;
+            }
+            case Strategy::FenwickTree: {
+                FenwickCache& tree = cacheToBuild<FenwickCache>();
+                archive(tree);
+                cacheLoaded = tree.size() == regions.size();
+                break;
+            }
+            case Strategy::LinearScan:
+                cacheLoaded = true;  // Nothing to cache beyond the total
+                break;
+            default:
+                break;
+        }
+
+        if (engineAllowed && cacheLoaded && fingerprint == weightFingerprint()) {
+            totalWeight = savedTotal;
+            uniformWeights = savedUniform;
+            totalWeightDirty = false;
+            if (EngineState* state = engineState.get()) {
+                state->prefixSumsValid = *savedStrategy == Strategy::PrefixSum;
+                state->cacheValid = *savedStrategy == Strategy::AliasTable || *savedStrategy == Strategy::FenwickTree;
+                state->updatesSinceBuild = 0;
+            }
+            return;
+        }
+        switchStrategy(activeStrategy);  // Frees a cache read for an engine the wheel does not use
+        warmActiveEngine();
+    }
+
+    /**
+     * @brief Converts an engine byte read from an archive to a concrete engine
+     * @param engine The byte
+     * @return The engine, or nullopt for Automatic and out-of-range values
+     */
+    static std::optional<Strategy> concreteEngine(std::uint8_t engine) {
+        for (const Strategy candidate : {Strategy::LinearScan, Strategy::PrefixSum, Strategy::AliasTable,
+                                         Strategy::FenwickTree, Strategy::StochasticAcceptance,
+                                         Strategy::PowerOfTwoBuckets}) {
+            if (engine == static_cast<std::uint8_t>(candidate)) {
+                return candidate;
+            }
+        }
+        return std::nullopt;
+    }
+
+    /**
+     * @brief Hashes the region weights (FNV-1a over 64-bit words) to validate saved caches
+     * @return The fingerprint
+     */
+    std::uint64_t weightFingerprint() const {
+        std::uint64_t hash = 14695981039346656037ull ^ regions.size();
+        for (const auto& region : regions) {
+            const W weight = region.getWeight();
+            std::uint64_t word = 0;
+            std::memcpy(&word, &weight, std::min(sizeof(W), sizeof(word)));
+            hash = (hash ^ word) * 1099511628211ull;
+        }
+        return hash;
     }
 #endif
 };
 
-
+/**
+ * @brief RouletteWheel whose region storage is drawn from a std::pmr::memory_resource
+ *
+ * Pass a resource (e.g. a std::pmr::monotonic_buffer_resource reset once per tick) to the
+ * constructor to avoid global heap traffic for short-lived wheels.
+ */
+template<typename E, typename W>
+using PmrRouletteWheel = RouletteWheel<E, W, std::pmr::polymorphic_allocator<WheelRegion<E, W>>>;
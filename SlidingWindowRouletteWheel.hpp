@@ -0,0 +1,256 @@
+#pragma once
+
+#include "classes/FenwickTree.hpp"
+#include "classes/WheelRandom.hpp"
+#include "classes/WheelRegion.hpp"
+#include <cstddef>
+#include <optional>
+#include <sstream>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/**
+ * @brief A roulette wheel over only the most recently added regions.
+ *
+ * Regions live in a ring buffer of windowSize slots with a Fenwick tree over the slot weights.
+ * Adding a region to a full window overwrites the oldest one in place, so adding, evicting
+ * and selecting all cost O(log windowSize) with no erase, search or reallocation. Evicted
+ * slots keep a weight of zero until they are reused.
+ *
+ * Elements are not merged: adding an element that is already in the window adds a second
+ * region, which ages out on its own.
+ *
+ * @tparam E Element type to store
+ * @tparam W Weight type (must be numeric: int, float, double, etc.)
+ */
+template<typename E, typename W>
+class SlidingWindowRouletteWheel {
+public:
+    /*** Constructors ***/
+
+    /**
+     * @brief Creates an empty window
+     * @param windowSize Number of most recent regions to keep
+     * @throws std::invalid_argument if windowSize is 0
+     */
+    explicit SlidingWindowRouletteWheel(size_t windowSize)
+        : windowSize(windowSize) {
+        if (windowSize == 0) {
+            throw std::invalid_argument("SlidingWindowRouletteWheel: window size must be positive");
+        }
+    }
+
+    /*** Selection Methods ***/
+
+    /**
+     * @brief Selects an element from the window using weighted random selection in O(log windowSize)
+     * @return The selected element
+     * @throws std::runtime_error if the window is empty
+     */
+    E select() const {
+        if (count == 0) {
+            throw std::runtime_error("SlidingWindowRouletteWheel::select: window is empty");
+        }
+        size_t slot = tree.find(WheelRandom::weightBelow(tree.getTotal()));
+        // Rounding in a drifted tree can land on an evicted slot; an exact rebuild fixes that
+        while (!isOccupied(slot)) {
+            rebuildTree();
+            slot = tree.find(WheelRandom::weightBelow(tree.getTotal()));
+        }
+        return slots[slot].getElement();
+    }
+
+    /**
+     * @brief Selects an element and returns it as an optional (safe version)
+     * @return Optional containing the selected element, or nullopt if the window is empty
+     */
+    std::optional<E> selectSafe() const {
+        if (count == 0) {
+            return std::nullopt;
+        }
+        return select();
+    }
+
+    /*** Modification Methods ***/
+
+    /**
+     * @brief Adds a region as the newest in the window, evicting the oldest if the window is full
+     * @param element The element to add
+     * @param weight The weight for this element (must be positive)
+     * @return The evicted element, or nullopt if the window had room
+     * @throws std::invalid_argument if weight is negative or zero
+     */
+    std::optional<E> addRegion(E element, W weight) {
+        validateWeight(weight, "addRegion");
+
+        if (count == windowSize) {
+            // Overwrite the oldest slot with a single tree update for the eviction and the insertion
+            const size_t slot = oldest;
+            std::optional<E> evicted(slots[slot].extractElement());
+            tree.add(slot, weight - slots[slot].getWeight());
+            slots[slot] = WheelRegion<E, W>(std::move(element), weight);
+            oldest = (oldest + 1) % windowSize;
+            noteTreeUpdate();
+            return evicted;
+        }
+
+        const size_t slot = (oldest + count) % windowSize;
+        if (slot == slots.size()) {
+            slots.emplace_back(std::move(element), weight);
+            tree.pushBack(weight);
+        } else {
+            slots[slot] = WheelRegion<E, W>(std::move(element), weight);
+            tree.add(slot, weight);
+            noteTreeUpdate();
+        }
+        ++count;
+        return std::nullopt;
+    }
+
+    /**
+     * @brief Removes the oldest region from the window
+     * @return The evicted element, or nullopt if the window is empty
+     */
+    std::optional<E> evictOldest() {
+        if (count == 0) {
+            return std::nullopt;
+        }
+        const size_t slot = oldest;
+        tree.add(slot, -slots[slot].getWeight());
+        slots[slot].setWeight(W{0});
+        oldest = (oldest + 1) % windowSize;
+        --count;
+        noteTreeUpdate();
+        return slots[slot].extractElement();
+    }
+
+    /**
+     * @brief Removes every region (the slot storage is kept for reuse)
+     */
+    void clear() {
+        slots.clear();
+        tree.clear();
+        oldest = 0;
+        count = 0;
+        updatesSinceBuild = 0;
+    }
+
+    /*** Query Methods ***/
+
+    /**
+     * @brief Checks if the window holds no regions
+     * @return true if empty, false otherwise
+     */
+    bool empty() const {
+        return count == 0;
+    }
+
+    /**
+     * @brief Checks if the next addRegion will evict the oldest region
+     * @return true if the window is full
+     */
+    bool full() const {
+        return count == windowSize;
+    }
+
+    /**
+     * @brief Gets the number of regions in the window
+     * @return Number of regions
+     */
+    size_t size() const {
+        return count;
+    }
+
+    /**
+     * @brief Gets the number of most recent regions the window keeps
+     * @return Window size
+     */
+    size_t capacity() const {
+        return windowSize;
+    }
+
+    /**
+     * @brief Gets the sum of the weights in the window
+     * @return Total weight
+     */
+    W getTotalWeight() const {
+        return tree.getTotal();
+    }
+
+    /**
+     * @brief Gets a region by age
+     * @param age 0 for the oldest region, size() - 1 for the newest
+     * @return Const reference to the region
+     * @throws std::out_of_range if age is not less than size()
+     */
+    const WheelRegion<E, W>& getRegion(size_t age) const {
+        if (age >= count) {
+            std::ostringstream msg;
+            msg << "SlidingWindowRouletteWheel::getRegion: age " << age
+                << " is out of range for " << count << " regions";
+            throw std::out_of_range(msg.str());
+        }
+        return slots[(oldest + age) % windowSize];
+    }
+
+    /**
+     * @brief Calculates the selection probability of a region by age
+     * @param age 0 for the oldest region, size() - 1 for the newest
+     * @return Probability fraction (0.0 to 1.0)
+     * @throws std::out_of_range if age is not less than size()
+     */
+    double getSelectionProbability(size_t age) const {
+        return static_cast<double>(getRegion(age).getWeight()) / static_cast<double>(tree.getTotal());
+    }
+
+    /**
+     * @brief Seeds the shared random number generator for the current thread.
+     * @param seed The seed value
+     * @note The engine is shared by all wheels on the calling thread.
+     */
+    void seedRandom(unsigned int seed) {
+        WheelRandom::seed(seed);
+    }
+
+private:
+    /*** Member Variables ***/
+    size_t windowSize;
+    std::vector<WheelRegion<E, W>> slots; ///< Ring buffer; grows to windowSize, then slots are reused
+    mutable FenwickTree<W> tree;          ///< Slot weights (0 for evicted slots)
+    size_t oldest = 0;                    ///< Slot of the oldest region
+    size_t count = 0;
+    mutable size_t updatesSinceBuild = 0;
+
+    /*** Private Helper Methods ***/
+
+    bool isOccupied(size_t slot) const {
+        return (slot + windowSize - oldest) % windowSize < count;
+    }
+
+    /**
+     * @brief Rebuilds floating-point trees once their updates outnumber the slots, so rounding
+     *        error from repeated adds and evictions stays bounded (amortised O(1) per update)
+     */
+    void noteTreeUpdate() const {
+        if (std::is_floating_point_v<W> && ++updatesSinceBuild > slots.size()) {
+            rebuildTree();
+        }
+    }
+
+    void rebuildTree() const {
+        tree.build(slots.size(), [this](size_t slot) {
+            return isOccupied(slot) ? slots[slot].getWeight() : W{0};
+        });
+        updatesSinceBuild = 0;
+    }
+
+    static void validateWeight(W weight, const char* caller) {
+        if (weight <= 0) {
+            std::ostringstream msg;
+            msg << "SlidingWindowRouletteWheel::" << caller << ": weight must be positive, got " << weight;
+            throw std::invalid_argument(msg.str());
+        }
+    }
+};
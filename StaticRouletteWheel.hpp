@@ -0,0 +1,360 @@
+#pragma once
+
+#include "classes/WheelRegion.hpp"
+#include "classes/WheelRandom.hpp"
+#include <array>
+#include <cstddef>
+#include <initializer_list>
+#include <optional>
+#include <sstream>
+#include <stdexcept>
+#include <tuple>
+#include <utility>
+
+/**
+ * @brief A fixed-capacity roulette wheel that stores up to N regions inline.
+ *
+ * Offers the same select/add/remove API as RouletteWheel without any heap allocation,
+ * which suits the many small decision wheels (a handful of NPC actions, a few rarity
+ * tiers) that are created per entity. The wheel is trivially copyable whenever E and W
+ * are, so copying one is a plain memcpy.
+ *
+ * @tparam E Element type to store (must be default constructible)
+ * @tparam W Weight type (must be numeric: int, float, double, etc.)
+ * @tparam N Maximum number of regions
+ */
+template<typename E, typename W, size_t N>
+class StaticRouletteWheel {
+public:
+    static_assert(N > 0, "StaticRouletteWheel: capacity N must be positive");
+
+    /*** Constructors ***/
+
+    /**
+     * @brief Default constructor - creates an empty wheel
+     */
+    StaticRouletteWheel() = default;
+
+    /**
+     * @brief Constructs a wheel from a list of element-weight tuples
+     * @param elementWeightPairs List of (element, weight) tuples
+     * @throws std::invalid_argument if a weight is negative or zero
+     * @throws std::length_error if the list holds more than N distinct elements
+     */
+    StaticRouletteWheel(std::initializer_list<std::tuple<E, W>> elementWeightPairs) {
+        for (const auto& [element, weight] : elementWeightPairs) {
+            addRegion(element, weight);
+        }
+    }
+
+    /*** Selection Methods ***/
+
+    /**
+     * @brief Selects an element using weighted random selection
+     * @return The selected element
+     * @throws std::runtime_error if the wheel is empty
+     */
+    E select() const {
+        return regions[selectIndex()].getElement();
+    }
+
+    /**
+     * @brief Selects an element and returns it as an optional (safe version)
+     * @return Optional containing the selected element, or nullopt if wheel is empty
+     */
+    std::optional<E> selectSafe() const {
+        if (count == 0) {
+            return std::nullopt;
+        }
+        return select();
+    }
+
+    /**
+     * @brief Selects an element and modifies its weight
+     * @param weightDelta Amount to add to the selected element's weight (can be negative)
+     * @return The selected element
+     * @throws std::runtime_error if the wheel is empty
+     */
+    E selectAndModifyWeight(W weightDelta = -1) {
+        const size_t index = selectIndex();
+        const W newWeight = regions[index].getWeight() + weightDelta;
+        if (newWeight <= 0) {
+            return extractRegionAt(index);
+        }
+
+        regions[index].setWeight(newWeight);
+        refreshTotalWeight();
+        return regions[index].getElement();
+    }
+
+    /**
+     * @brief Selects an element and removes it from the wheel
+     * @return The selected element, moved out of the wheel
+     * @throws std::runtime_error if the wheel is empty
+     */
+    E selectAndRemove() {
+        return extractRegionAt(selectIndex());
+    }
+
+    /**
+     * @brief Selects an element and removes it from the wheel (safe version)
+     * @return Optional containing the selected element, or nullopt if the wheel is empty
+     */
+    std::optional<E> selectAndRemoveSafe() {
+        if (count == 0) {
+            return std::nullopt;
+        }
+        return selectAndRemove();
+    }
+
+    /*** Modification Methods ***/
+
+    /**
+     * @brief Adds a new region to the wheel or combines weight if element exists
+     * @param element The element to add
+     * @param weight The weight for this element (must be positive)
+     * @throws std::invalid_argument if weight is negative or zero
+     * @throws std::length_error if the element is new and the wheel already holds N regions
+     */
+    void addRegion(const E& element, W weight) {
+        insertRegion(E(element), weight);
+    }
+
+    /**
+     * @brief Adds a new region to the wheel or combines weight if element exists,
+     *        moving the element into the wheel
+     * @param element The element to add
+     * @param weight The weight for this element (must be positive)
+     * @throws std::invalid_argument if weight is negative or zero
+     * @throws std::length_error if the element is new and the wheel already holds N regions
+     */
+    void addRegion(E&& element, W weight) {
+        insertRegion(std::move(element), weight);
+    }
+
+    /**
+     * @brief Constructs an element from the given arguments and adds it to the wheel
+     * @param weight The weight for this element (must be positive)
+     * @param args Arguments forwarded to the element's constructor
+     * @throws std::invalid_argument if weight is negative or zero
+     * @throws std::length_error if the element is new and the wheel already holds N regions
+     */
+    template<typename... Args>
+    void emplaceRegion(W weight, Args&&... args) {
+        insertRegion(E(std::forward<Args>(args)...), weight);
+    }
+
+    /**
+     * @brief Removes a specific element from the wheel
+     * @param element The element to remove
+     * @return true if element was found and removed, false otherwise
+     */
+    bool removeElement(const E& element) {
+        const auto index = findElementIndex(element);
+        if (!index.has_value()) {
+            return false;
+        }
+
+        extractRegionAt(*index);
+        return true;
+    }
+
+    /**
+     * @brief Removes all regions with weight <= 0
+     * @return Number of regions removed
+     */
+    size_t removeInvalidRegions() {
+        const size_t originalCount = count;
+        size_t kept = 0;
+        for (size_t i = 0; i < count; ++i) {
+            if (regions[i].getWeight() <= 0) {
+                continue;
+            }
+            if (kept != i) {
+                regions[kept] = std::move(regions[i]);
+            }
+            ++kept;
+        }
+        clearSlots(kept, count);
+        count = kept;
+        refreshTotalWeight();
+        return originalCount - count;
+    }
+
+    /*** Query Methods ***/
+
+    /**
+     * @brief Checks if the wheel has no regions
+     * @return true if empty, false otherwise
+     */
+    bool empty() const {
+        return count == 0;
+    }
+
+    /**
+     * @brief Checks if the wheel holds its maximum number of regions
+     * @return true if no more distinct elements can be added
+     */
+    bool full() const {
+        return count == N;
+    }
+
+    /**
+     * @brief Gets the number of regions in the wheel
+     * @return Number of regions
+     */
+    size_t size() const {
+        return count;
+    }
+
+    /**
+     * @brief Gets the maximum number of regions the wheel can hold
+     * @return N
+     */
+    static constexpr size_t capacity() {
+        return N;
+    }
+
+    /**
+     * @brief Calculates the selection probability for an element as a fraction
+     * @param element The element to query
+     * @return Probability fraction (0.0 to 1.0), or 0.0 if element not found
+     */
+    double getSelectionProbability(const E& element) const {
+        const auto index = findElementIndex(element);
+        if (!index.has_value() || totalWeight <= 0) {
+            return 0.0;
+        }
+        return static_cast<double>(regions[*index].getWeight()) / static_cast<double>(totalWeight);
+    }
+
+    /**
+     * @brief Gets an iterator to the first region
+     * @return Pointer to the first region
+     */
+    const WheelRegion<E, W>* begin() const {
+        return regions.data();
+    }
+
+    /**
+     * @brief Gets an iterator one past the last region
+     * @return Pointer one past the last region
+     */
+    const WheelRegion<E, W>* end() const {
+        return regions.data() + count;
+    }
+
+    /**
+     * @brief Seeds the shared random number generator for the current thread.
+     * @param seed The seed value
+     * @note The engine is shared by all wheels on the calling thread.
+     */
+    void seedRandom(unsigned int seed) {
+        WheelRandom::seed(seed);
+    }
+
+private:
+    /*** Member Variables ***/
+    std::array<WheelRegion<E, W>, N> regions{};
+    size_t count = 0;
+    W totalWeight = W{0};
+
+    /*** Private Helper Methods ***/
+
+    /**
+     * @brief Picks the index of a region using weighted random selection
+     * @return Index of the selected region
+     * @throws std::runtime_error if the wheel is empty
+     */
+    size_t selectIndex() const {
+        if (count == 0) {
+            throw std::runtime_error("StaticRouletteWheel::select: wheel is empty");
+        }
+
+        if (count == 1) {
+            return 0;
+        }
+
+        return WheelRandom::indexByWeight(count, [this](size_t i) { return regions[i].getWeight(); }, totalWeight);
+    }
+
+    /**
+     * @brief Adds an owned element, combining weight into an existing equal element
+     * @param element The element to add
+     * @param weight The weight for this element
+     */
+    void insertRegion(E&& element, W weight) {
+        if (weight <= 0) {
+            std::ostringstream msg;
+            msg << "StaticRouletteWheel::addRegion: weight must be positive, got " << weight;
+            throw std::invalid_argument(msg.str());
+        }
+
+        const auto existingIndex = findElementIndex(element);
+        if (existingIndex.has_value()) {
+            regions[*existingIndex].setWeight(regions[*existingIndex].getWeight() + weight);
+            totalWeight += weight;
+            return;
+        }
+
+        if (count == N) {
+            throw std::length_error("StaticRouletteWheel::addRegion: wheel is full");
+        }
+
+        regions[count] = WheelRegion<E, W>(std::move(element), weight);
+        ++count;
+        totalWeight += weight;
+    }
+
+    /**
+     * @brief Moves the element at the given index out of the wheel and closes the gap
+     * @param index Index of the region to remove
+     * @return The removed element
+     */
+    E extractRegionAt(size_t index) {
+        E element = regions[index].extractElement();
+        for (size_t i = index + 1; i < count; ++i) {
+            regions[i - 1] = std::move(regions[i]);
+        }
+        --count;
+        clearSlots(count, count + 1);
+        refreshTotalWeight();
+        return element;
+    }
+
+    /**
+     * @brief Resets unused slots so they do not keep removed elements alive
+     * @param first First slot to reset
+     * @param last One past the last slot to reset
+     */
+    void clearSlots(size_t first, size_t last) {
+        for (size_t i = first; i < last; ++i) {
+            regions[i] = WheelRegion<E, W>();
+        }
+    }
+
+    /**
+     * @brief Recomputes the cached total weight (at most N additions) after a weight
+     *        decrease or removal, so floating-point totals never drift
+     */
+    void refreshTotalWeight() {
+        totalWeight = W{0};
+        for (size_t i = 0; i < count; ++i) {
+            totalWeight += regions[i].getWeight();
+        }
+    }
+
+    /**
+     * @brief Finds the index of an element among the occupied slots
+     * @param element The element to find
+     * @return Optional containing the index, or nullopt if not found
+     */
+    std::optional<size_t> findElementIndex(const E& element) const {
+        for (size_t i = 0; i < count; ++i) {
+            if (regions[i].getElement() == element) {
+                return i;
+            }
+        }
+        return std::nullopt;
+    }
+};
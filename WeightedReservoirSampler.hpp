@@ -0,0 +1,323 @@
+#pragma once
+
+#include "classes/WheelRandom.hpp"
+#include "classes/WheelRegion.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <sstream>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+/**
+ * @brief Sampling algorithms available to WeightedReservoirSampler (both produce the same distribution)
+ */
+enum class ReservoirAlgorithm {
+    ReservoirKeys,    ///< A-Res: one random key per offered item
+    ExponentialJumps  ///< A-ExpJ: random numbers only for items that enter the reservoir
+};
+
+/**
+ * @brief Weighted sampling of k items, without replacement, from a stream of unknown length.
+ *
+ * Every offered item gets a random key log(u) / weight (Efraimidis and Spirakis), and the
+ * reservoir keeps the k items with the largest keys in a min-heap. The kept items are
+ * distributed like k draws without replacement from a RouletteWheel holding the whole
+ * stream, while memory stays O(k).
+ *
+ * With Algorithm::ExponentialJumps (A-ExpJ, the default) the sampler draws how much weight
+ * to skip before the next item that enters the reservoir, so most offers cost a subtraction
+ * and no random number. Algorithm::ReservoirKeys (A-Res) draws a key for every item.
+ *
+ * Reservoirs filled from disjoint shards of a stream can be merged: the k largest keys of
+ * the union are a sample of the combined stream.
+ *
+ * @tparam E Element type to store
+ * @tparam W Weight type (must be numeric: int, float, double, etc.)
+ */
+template<typename E, typename W>
+class WeightedReservoirSampler {
+public:
+    /// Sampling algorithms (see ReservoirAlgorithm)
+    using Algorithm = ReservoirAlgorithm;
+
+    /**
+     * @brief Construction options for WeightedReservoirSampler
+     */
+    struct Options {
+        /**
+         * @brief When true, items with weight <= 0 are skipped (they could never be sampled)
+         * instead of throwing.
+         */
+        bool ignoreInvalidWeights = true;
+
+        /**
+         * @brief Sampling algorithm
+         */
+        Algorithm algorithm = Algorithm::ExponentialJumps;
+    };
+
+    /*** Constructors ***/
+
+    /**
+     * @brief Creates an empty reservoir
+     * @param capacity Number of items to sample (k)
+     * @throws std::invalid_argument if capacity is 0
+     */
+    explicit WeightedReservoirSampler(size_t capacity)
+        : WeightedReservoirSampler(capacity, Options{}) {
+    }
+
+    /**
+     * @brief Creates an empty reservoir with the given options
+     * @param capacity Number of items to sample (k)
+     * @param options Sampler options (e.g. the sampling algorithm)
+     * @throws std::invalid_argument if capacity is 0
+     */
+    WeightedReservoirSampler(size_t capacity, Options options)
+        : options(options)
+        , sampleCapacity(capacity) {
+        if (capacity == 0) {
+            throw std::invalid_argument("WeightedReservoirSampler: capacity must be positive");
+        }
+        entries.reserve(capacity);
+    }
+
+    /*** Modification Methods ***/
+
+    /**
+     * @brief Offers a stream item to the reservoir
+     * @param element The item
+     * @param weight The item's weight
+     * @return true if the item entered the reservoir (it may be evicted by a later item)
+     * @throws std::invalid_argument if weight is <= 0 and invalid weights are not ignored
+     */
+    bool offer(const E& element, W weight) {
+        return offerItem(element, weight);
+    }
+
+    /**
+     * @brief Offers a stream item, moving it into the reservoir if it is kept
+     * @param element The item (left moved-from only if it entered the reservoir)
+     * @param weight The item's weight
+     * @return true if the item entered the reservoir (it may be evicted by a later item)
+     * @throws std::invalid_argument if weight is <= 0 and invalid weights are not ignored
+     */
+    bool offer(E&& element, W weight) {
+        return offerItem(std::move(element), weight);
+    }
+
+    /**
+     * @brief Merges a reservoir filled from another shard of the stream
+     *
+     * Afterwards this reservoir samples the union of both shards. The shards must be disjoint
+     * and sampled independently (e.g. on different threads).
+     *
+     * @param other Reservoir to merge (left unchanged)
+     * @throws std::invalid_argument if other is this reservoir (a shard is not disjoint from
+     *         itself) or the capacities differ
+     */
+    void merge(const WeightedReservoirSampler& other) {
+        if (&other == this) {
+            throw std::invalid_argument("WeightedReservoirSampler::merge: cannot merge a reservoir into itself");
+        }
+        if (other.sampleCapacity != sampleCapacity) {
+            std::ostringstream msg;
+            msg << "WeightedReservoirSampler::merge: capacities differ (" << sampleCapacity
+                << " vs " << other.sampleCapacity << ")";
+            throw std::invalid_argument(msg.str());
+        }
+        for (const Entry& entry : other.entries) {
+            insertKeyed(entry.key, WheelRegion<E, W>(entry.region));
+        }
+        offeredCount += other.offeredCount;
+        offeredWeight += other.offeredWeight;
+        drawJump();
+    }
+
+    /**
+     * @brief Empties the reservoir and forgets the stream seen so far
+     */
+    void clear() {
+        entries.clear();
+        offeredCount = 0;
+        offeredWeight = 0.0;
+        remainingJump = 0.0;
+    }
+
+    /*** Query Methods ***/
+
+    /**
+     * @brief Gets the sampled items, in the order weighted draws without replacement would
+     *        have produced them (largest key first)
+     * @return Up to capacity() element-weight regions
+     */
+    std::vector<WheelRegion<E, W>> getSample() const {
+        std::vector<const Entry*> ordered;
+        ordered.reserve(entries.size());
+        for (const Entry& entry : entries) {
+            ordered.push_back(&entry);
+        }
+        std::sort(ordered.begin(), ordered.end(), [](const Entry* a, const Entry* b) { return a->key > b->key; });
+
+        std::vector<WheelRegion<E, W>> sample;
+        sample.reserve(ordered.size());
+        for (const Entry* entry : ordered) {
+            sample.push_back(entry->region);
+        }
+        return sample;
+    }
+
+    /**
+     * @brief Gets the number of sampled items (capacity() once enough items were offered)
+     * @return Number of items in the reservoir
+     */
+    size_t size() const {
+        return entries.size();
+    }
+
+    /**
+     * @brief Checks if the reservoir holds no items
+     * @return true if empty, false otherwise
+     */
+    bool empty() const {
+        return entries.empty();
+    }
+
+    /**
+     * @brief Gets the number of items the reservoir samples (k)
+     * @return Capacity
+     */
+    size_t capacity() const {
+        return sampleCapacity;
+    }
+
+    /**
+     * @brief Gets the number of valid items offered so far, including merged shards
+     * @return Number of items
+     */
+    size_t itemsOffered() const {
+        return offeredCount;
+    }
+
+    /**
+     * @brief Gets the total weight of the valid items offered so far, including merged shards
+     * @return Total weight
+     */
+    double weightOffered() const {
+        return offeredWeight;
+    }
+
+    /**
+     * @brief Seeds the shared random number generator for the current thread.
+     * @param seed The seed value
+     * @note The engine is shared by all wheels on the calling thread.
+     */
+    void seedRandom(unsigned int seed) {
+        WheelRandom::seed(seed);
+    }
+
+private:
+    struct Entry {
+        double key; ///< log(u) / weight; the reservoir keeps the largest keys
+        WheelRegion<E, W> region;
+    };
+
+    /*** Member Variables ***/
+    Options options;
+    size_t sampleCapacity;
+    std::vector<Entry> entries;  ///< Min-heap on key (smallest key at the front)
+    size_t offeredCount = 0;
+    double offeredWeight = 0.0;
+    double remainingJump = 0.0;  ///< A-ExpJ: weight still to skip before the next insertion
+
+    /*** Private Helper Methods ***/
+
+    template<typename Element>
+    bool offerItem(Element&& element, W weight) {
+        if (!(weight > W{0})) {
+            if (!options.ignoreInvalidWeights) {
+                std::ostringstream msg;
+                msg << "WeightedReservoirSampler::offer: weight must be positive, got " << weight
+                    << " (use Options{.ignoreInvalidWeights=true} to skip such items)";
+                throw std::invalid_argument(msg.str());
+            }
+            return false;
+        }
+
+        const double w = static_cast<double>(weight);
+        ++offeredCount;
+        offeredWeight += w;
+
+        if (entries.size() < sampleCapacity) {
+            insertKeyed(std::log(uniformUnit()) / w, WheelRegion<E, W>(std::forward<Element>(element), weight));
+            if (entries.size() == sampleCapacity) {
+                drawJump();
+            }
+            return true;
+        }
+
+        double key;
+        if (options.algorithm == Algorithm::ExponentialJumps) {
+            remainingJump -= w;
+            if (remainingJump > 0.0) {
+                return false;
+            }
+            // Draw the key conditioned on beating the current minimum: u in (threshold^w, 1]
+            const double floor = std::exp(w * entries.front().key);
+            key = std::log(floor + (1.0 - floor) * uniformUnit()) / w;
+        } else {
+            key = std::log(uniformUnit()) / w;
+            if (key <= entries.front().key) {
+                return false;
+            }
+        }
+
+        replaceMinimum(key, WheelRegion<E, W>(std::forward<Element>(element), weight));
+        if (options.algorithm == Algorithm::ExponentialJumps) {
+            drawJump();
+        }
+        return true;
+    }
+
+    /**
+     * @brief Adds a keyed item if there is room or its key beats the smallest kept key
+     */
+    void insertKeyed(double key, WheelRegion<E, W> region) {
+        if (entries.size() < sampleCapacity) {
+            entries.push_back(Entry{key, std::move(region)});
+            std::push_heap(entries.begin(), entries.end(), isLater);
+        } else if (key > entries.front().key) {
+            replaceMinimum(key, std::move(region));
+        }
+    }
+
+    void replaceMinimum(double key, WheelRegion<E, W> region) {
+        std::pop_heap(entries.begin(), entries.end(), isLater);
+        entries.back() = Entry{key, std::move(region)};
+        std::push_heap(entries.begin(), entries.end(), isLater);
+    }
+
+    /**
+     * @brief A-ExpJ: draws the weight to skip before the next item that beats the smallest key
+     */
+    void drawJump() {
+        if (entries.size() < sampleCapacity) {
+            remainingJump = 0.0;
+            return;
+        }
+        const double threshold = entries.front().key;
+        remainingJump = threshold < 0.0 ? std::log(uniformUnit()) / threshold : 0.0;
+    }
+
+    /// Heap order that keeps the smallest key at the front
+    static bool isLater(const Entry& a, const Entry& b) {
+        return a.key > b.key;
+    }
+
+    /// Uniform draw in (0, 1], so its logarithm is finite
+    static double uniformUnit() {
+        return 1.0 - WheelRandom::weightBelow(1.0);
+    }
+};
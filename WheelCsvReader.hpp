@@ -0,0 +1,397 @@
+#pragma once
+
+#include "RouletteWheel.hpp"
+#include "classes/MappedFile.hpp"
+#include <algorithm>
+#include <charconv>
+#include <cerrno>
+#include <cmath>
+#include <cstddef>
+#include <cstdlib>
+#include <cstring>
+#include <istream>
+#include <optional>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/**
+ * @brief Streams `element,weight` records from CSV or TSV text straight into a RouletteWheel.
+ *
+ * Input is read in fixed-size chunks (or walked in place for a memory-mapped file) and every
+ * record goes directly into the wheel, so a table is never held twice in memory. Elements may
+ * be quoted ("a, b" with "" for a literal quote); blank lines are skipped and CRLF line endings
+ * are accepted. Records with a non-positive weight follow the wheel's
+ * Options::ignoreInvalidWeights. Lines that cannot be parsed are skipped and reported.
+ *
+ * Elements are read as std::string (or any type constructible from one that owns its data, so
+ * not std::string_view) or, for arithmetic element types, parsed as numbers. Repeated elements
+ * combine their weights, as with addRegion.
+ */
+class WheelCsvReader {
+public:
+    /**
+     * @brief Text format of the input
+     */
+    struct Format {
+        char delimiter = ',';          ///< Field separator ('\t' for TSV)
+        bool hasHeader = false;        ///< Skip the first line
+        size_t chunkSize = 1 << 20;    ///< Bytes read from a stream at a time
+        size_t maxReportedLines = 100; ///< Malformed lines kept in the report (all are counted)
+    };
+
+    /**
+     * @brief A line that could not be parsed
+     */
+    struct MalformedLine {
+        size_t lineNumber;   ///< 1-based line number
+        std::string reason;  ///< What was wrong with the line
+        std::string text;    ///< The line (truncated to maxLineTextLength characters)
+    };
+
+    /**
+     * @brief Summary of a load
+     */
+    struct Report {
+        size_t linesRead = 0;      ///< Lines read, including blank lines and the header
+        size_t recordsAdded = 0;   ///< Records added to (or combined into) the wheel
+        size_t invalidWeights = 0; ///< Records skipped for a weight <= 0
+        size_t malformedCount = 0; ///< Lines that could not be parsed
+        std::vector<MalformedLine> malformedLines; ///< The first Format::maxReportedLines of them
+
+        /**
+         * @brief Checks whether every line was parsed
+         * @return true if no line was malformed
+         */
+        bool ok() const {
+            return malformedCount == 0;
+        }
+    };
+
+    /// Longest line text copied into a MalformedLine
+    static constexpr size_t maxLineTextLength = 120;
+
+    /*** Constructors ***/
+
+    /**
+     * @brief Creates a reader for comma-separated input without a header
+     */
+    WheelCsvReader()
+        : WheelCsvReader(Format{}) {
+    }
+
+    /**
+     * @brief Creates a reader for the given format
+     * @param format Delimiter, header and chunking options
+     * @throws std::invalid_argument if the delimiter is a quote or line break, or chunkSize is 0
+     */
+    explicit WheelCsvReader(Format format)
+        : format(format) {
+        if (format.delimiter == '"' || format.delimiter == '\n' || format.delimiter == '\r') {
+            throw std::invalid_argument("WheelCsvReader: delimiter must not be a quote or line break");
+        }
+        if (format.chunkSize == 0) {
+            throw std::invalid_argument("WheelCsvReader: chunkSize must be positive");
+        }
+    }
+
+    /*** Reading ***/
+
+    /**
+     * @brief Adds every record of a stream to a wheel, reading it chunk by chunk
+     * @param in Stream to read until end of file
+     * @param wheel Wheel receiving the records
+     * @return Counts of the records added and skipped, and the malformed lines
+     * @throws std::invalid_argument if a weight is <= 0 and the wheel does not ignore invalid
+     *         weights (records before that line stay on the wheel)
+     * @throws std::runtime_error if reading the stream fails
+     */
+    template<typename E, typename W, typename Allocator>
+    Report read(std::istream& in, RouletteWheel<E, W, Allocator>& wheel) const {
+        LineParser<E, W, Allocator> parser(format, wheel);
+        std::vector<char> chunk(format.chunkSize);
+        std::string partialLine;
+
+        while (in) {
+            in.read(chunk.data(), static_cast<std::streamsize>(chunk.size()));
+            const size_t count = static_cast<size_t>(in.gcount());
+            const char* position = chunk.data();
+            const char* const end = position + count;
+
+            while (const char* newline = static_cast<const char*>(std::memchr(position, '\n', end - position))) {
+                if (partialLine.empty()) {
+                    parser.parseLine(std::string_view(position, newline - position));
+                } else {
+                    partialLine.append(position, newline);
+                    parser.parseLine(partialLine);
+                    partialLine.clear();
+                }
+                position = newline + 1;
+            }
+            partialLine.append(position, end);
+        }
+        if (in.bad()) {
+            throw std::runtime_error("WheelCsvReader::read: failed to read the stream");
+        }
+        if (!partialLine.empty()) {
+            parser.parseLine(partialLine);
+        }
+        return parser.takeReport();
+    }
+
+    /**
+     * @brief Adds every record of a mapped file to a wheel, parsing it in place
+     * @param file The mapped file
+     * @param wheel Wheel receiving the records
+     * @return Counts of the records added and skipped, and the malformed lines
+     * @throws std::invalid_argument if a weight is <= 0 and the wheel does not ignore invalid weights
+     */
+    template<typename E, typename W, typename Allocator>
+    Report read(const MappedFile& file, RouletteWheel<E, W, Allocator>& wheel) const {
+        return read(std::string_view(static_cast<const char*>(file.data()), file.size()), wheel);
+    }
+
+    /**
+     * @brief Adds every record of a block of text to a wheel
+     * @param text The text
+     * @param wheel Wheel receiving the records
+     * @return Counts of the records added and skipped, and the malformed lines
+     * @throws std::invalid_argument if a weight is <= 0 and the wheel does not ignore invalid weights
+     */
+    template<typename E, typename W, typename Allocator>
+    Report read(std::string_view text, RouletteWheel<E, W, Allocator>& wheel) const {
+        // The whole text is at hand, so size the wheel once up front
+        wheel.reserve(wheel.size() + static_cast<size_t>(std::count(text.begin(), text.end(), '\n')) + 1);
+
+        LineParser<E, W, Allocator> parser(format, wheel);
+        size_t position = 0;
+        while (position < text.size()) {
+            const size_t newline = std::min(text.find('\n', position), text.size());
+            parser.parseLine(text.substr(position, newline - position));
+            position = newline + 1;
+        }
+        return parser.takeReport();
+    }
+
+private:
+#if defined(__cpp_lib_to_chars) && __cpp_lib_to_chars >= 201611L
+    static constexpr bool hasFloatingFromChars = true;
+#else
+    static constexpr bool hasFloatingFromChars = false;  ///< Weights are parsed with strtod instead
+#endif
+
+    Format format;
+
+    /**
+     * @brief Parses lines one at a time into a wheel, tracking line numbers and the report
+     */
+    template<typename E, typename W, typename Allocator>
+    class LineParser {
+    public:
+        LineParser(const Format& format, RouletteWheel<E, W, Allocator>& wheel)
+            : format(format)
+            , wheel(wheel) {
+        }
+
+        void parseLine(std::string_view line) {
+            ++report.linesRead;
+            if (!line.empty() && line.back() == '\r') {
+                line.remove_suffix(1);
+            }
+            if ((format.hasHeader && report.linesRead == 1) || trim(line).empty()) {
+                return;
+            }
+
+            std::string_view elementField;
+            std::string_view weightField;
+            if (const char* reason = splitFields(line, elementField, weightField)) {
+                reportMalformed(line, reason);
+                return;
+            }
+
+            W weight{};
+            if (!parseNumber(weightField, weight)) {
+                reportMalformed(line, "weight is not a number");
+                return;
+            }
+            if constexpr (std::is_floating_point_v<W>) {
+                if (!std::isfinite(weight)) {
+                    reportMalformed(line, "weight is not finite");
+                    return;
+                }
+            }
+
+            std::optional<E> element = parseElement(elementField);
+            if (!element.has_value()) {
+                reportMalformed(line, "element is not a valid value");
+                return;
+            }
+
+            if (weight <= W{0}) {
+                if (!wheel.getOptions().ignoreInvalidWeights) {
+                    std::ostringstream msg;
+                    msg << "WheelCsvReader::read: line " << report.linesRead
+                        << ": weight must be positive, got " << weight
+                        << " (use Options{.ignoreInvalidWeights=true} to skip such records)";
+                    throw std::invalid_argument(msg.str());
+                }
+                ++report.invalidWeights;
+                return;
+            }
+
+            wheel.addRegion(std::move(*element), weight);
+            ++report.recordsAdded;
+        }
+
+        Report takeReport() {
+            return std::move(report);
+        }
+
+    private:
+        const Format& format;
+        RouletteWheel<E, W, Allocator>& wheel;
+        Report report;
+        std::string unquoted; ///< Scratch for quoted elements
+
+        /**
+         * @brief Splits a line into its element and weight fields
+         * @return nullptr on success, otherwise why the line is malformed
+         */
+        const char* splitFields(std::string_view line, std::string_view& elementField, std::string_view& weightField) {
+            std::string_view rest = trimFront(line);
+            if (!rest.empty() && rest.front() == '"') {
+                unquoted.clear();
+                size_t i = 1;
+                for (;;) {
+                    if (i >= rest.size()) {
+                        return "unterminated quote";
+                    }
+                    if (rest[i] == '"') {
+                        if (i + 1 < rest.size() && rest[i + 1] == '"') {
+                            unquoted.push_back('"');
+                            i += 2;
+                            continue;
+                        }
+                        ++i;
+                        break;
+                    }
+                    unquoted.push_back(rest[i++]);
+                }
+                rest = trimFront(rest.substr(i));
+                if (rest.empty() || rest.front() != format.delimiter) {
+                    return "missing delimiter";
+                }
+                elementField = unquoted;
+                rest.remove_prefix(1);
+            } else {
+                const size_t delimiter = rest.find(format.delimiter);
+                if (delimiter == std::string_view::npos) {
+                    return "missing delimiter";
+                }
+                elementField = trim(rest.substr(0, delimiter));
+                rest.remove_prefix(delimiter + 1);
+                if (elementField.empty()) {
+                    return "empty element";
+                }
+            }
+
+            if (rest.find(format.delimiter) != std::string_view::npos) {
+                return "expected 2 fields";
+            }
+            weightField = trim(rest);
+            return nullptr;
+        }
+
+        std::optional<E> parseElement(std::string_view field) const {
+            if constexpr (std::is_arithmetic_v<E>) {
+                E value{};
+                if (!parseNumber(field, value)) {
+                    return std::nullopt;
+                }
+                return value;
+            } else {
+                static_assert(std::is_constructible_v<E, std::string>,
+                              "WheelCsvReader: elements must be arithmetic or constructible from std::string");
+                // The field is copied into a temporary string, so a view would dangle
+                static_assert(!std::is_same_v<E, std::string_view>,
+                              "WheelCsvReader: elements must own their data (use std::string, not std::string_view)");
+                return E(std::string(field));
+            }
+        }
+
+        template<typename T>
+        static bool parseNumber(std::string_view field, T& value) {
+            if (field.size() > 1 && field.front() == '+') {
+                field.remove_prefix(1);
+            }
+            if constexpr (std::is_floating_point_v<T> && !hasFloatingFromChars) {
+                return parseFloatingFallback(field, value);
+            } else {
+                const char* const end = field.data() + field.size();
+                const auto [stop, error] = std::from_chars(field.data(), end, value);
+                return error == std::errc() && stop == end && !field.empty();
+            }
+        }
+
+        /**
+         * @brief Parses a floating-point field with strtod where the standard library does not
+         *        provide floating-point std::from_chars (__cpp_lib_to_chars, e.g. libstdc++
+         *        before 11 and libc++ before 17)
+         *
+         * strtod needs a terminated string, so the field is copied into an owned buffer first
+         * (short enough for the small-string buffer in practice). Forms from_chars would reject
+         * (a sign after the '+' already stripped, leading spaces, hexadecimal) are rejected too.
+         * Unlike from_chars, strtod follows the C locale's decimal point.
+         */
+        template<typename T>
+        static bool parseFloatingFallback(std::string_view field, T& value) {
+            if (field.empty() || field.front() == '+' || field.front() == ' ' || field.front() == '\t'
+                || field.find_first_of("xX") != std::string_view::npos) {
+                return false;
+            }
+            const std::string buffer(field);
+            char* stop = nullptr;
+            errno = 0;
+            if constexpr (std::is_same_v<T, float>) {
+                value = std::strtof(buffer.c_str(), &stop);
+            } else if constexpr (std::is_same_v<T, double>) {
+                value = std::strtod(buffer.c_str(), &stop);
+            } else {
+                value = std::strtold(buffer.c_str(), &stop);
+            }
+            return errno != ERANGE && stop == buffer.c_str() + buffer.size();
+        }
+
+        void reportMalformed(std::string_view line, const char* reason) {
+            ++report.malformedCount;
+            if (report.malformedLines.size() < format.maxReportedLines) {
+                report.malformedLines.push_back(
+                    MalformedLine{report.linesRead, reason, std::string(line.substr(0, maxLineTextLength))});
+            }
+        }
+
+        /// Spaces are trimmed around fields, and so are tabs unless they are the delimiter
+        bool isPadding(char c) const {
+            return c == ' ' || (c == '\t' && format.delimiter != '\t');
+        }
+
+        std::string_view trimFront(std::string_view text) const {
+            while (!text.empty() && isPadding(text.front())) {
+                text.remove_prefix(1);
+            }
+            return text;
+        }
+
+        std::string_view trim(std::string_view text) const {
+            text = trimFront(text);
+            while (!text.empty() && isPadding(text.back())) {
+                text.remove_suffix(1);
+            }
+            return text;
+        }
+    };
+};
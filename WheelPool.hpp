@@ -0,0 +1,304 @@
+#pragma once
+
+#include "classes/WheelRandom.hpp"
+#include <algorithm>
+#include <cstddef>
+#include <sstream>
+#include <stdexcept>
+#include <tuple>
+#include <vector>
+
+/**
+ * @brief Many small roulette wheels stored back to back, drawn from together.
+ *
+ * Every wheel's elements and cumulative weights live in shared arrays, and wheel i owns the
+ * slots [offsets[i], offsets[i + 1]) (compressed sparse row layout). selectAll() makes one draw
+ * per wheel in a single pass over those arrays, with no per-wheel object, pointer or engine to
+ * visit. Small wheels are searched with a branch-free count the compiler can vectorise; larger
+ * ones fall back to binary search.
+ *
+ * Wheels are added once and keep their regions; only weights can change afterwards. The pool
+ * carries no mutable state at selection time, so disjoint wheel ranges can be drawn from
+ * several threads at once with selectRange (each thread uses its own random engine).
+ *
+ * @tparam E Element type to store
+ * @tparam W Weight type (must be numeric: int, float, double, etc.)
+ */
+template<typename E, typename W>
+class WheelPool {
+public:
+    /// Identifies a wheel within the pool (wheels are numbered in the order they were added)
+    using WheelId = size_t;
+
+    /*** Constructors ***/
+
+    /**
+     * @brief Default constructor - creates an empty pool
+     */
+    WheelPool() = default;
+
+    /*** Selection Methods ***/
+
+    /**
+     * @brief Selects an element from one wheel
+     * @param wheel The wheel to draw from
+     * @return The selected element
+     * @throws std::out_of_range if wheel is not a wheel of this pool
+     */
+    E select(WheelId wheel) const {
+        checkWheel(wheel, "select");
+        return elements[selectSlot(offsets[wheel], offsets[wheel + 1])];
+    }
+
+    /**
+     * @brief Makes one draw from every wheel, in wheel order
+     * @param out Output iterator receiving wheelCount() elements
+     * @return The output iterator past the last written element
+     */
+    template<typename OutputIt>
+    OutputIt selectAll(OutputIt out) const {
+        return selectRange(0, wheelCount(), out);
+    }
+
+    /**
+     * @brief Makes one draw from each wheel in [first, last), e.g. one shard per thread
+     * @param first The first wheel to draw from
+     * @param last One past the last wheel to draw from
+     * @param out Output iterator receiving last - first elements
+     * @return The output iterator past the last written element
+     * @throws std::out_of_range if the range is not within the pool
+     */
+    template<typename OutputIt>
+    OutputIt selectRange(WheelId first, WheelId last, OutputIt out) const {
+        if (first > last || last > wheelCount()) {
+            std::ostringstream msg;
+            msg << "WheelPool::selectRange: range [" << first << ", " << last
+                << ") is not within the pool's " << wheelCount() << " wheels";
+            throw std::out_of_range(msg.str());
+        }
+        for (WheelId wheel = first; wheel < last; ++wheel) {
+            *out++ = elements[selectSlot(offsets[wheel], offsets[wheel + 1])];
+        }
+        return out;
+    }
+
+    /*** Modification Methods ***/
+
+    /**
+     * @brief Appends a wheel to the pool
+     * @param elementWeightPairs The wheel's (element, weight) tuples (duplicates are kept as
+     *        separate regions)
+     * @return The new wheel's id
+     * @throws std::invalid_argument if the list is empty or a weight is negative or zero
+     */
+    WheelId addWheel(const std::vector<std::tuple<E, W>>& elementWeightPairs) {
+        if (elementWeightPairs.empty()) {
+            throw std::invalid_argument("WheelPool::addWheel: a wheel needs at least one region");
+        }
+        for (const auto& [element, weight] : elementWeightPairs) {
+            validateWeight(weight, "addWheel");
+        }
+
+        W cumulative = W{0};
+        for (const auto& [element, weight] : elementWeightPairs) {
+            cumulative += weight;
+            elements.push_back(element);
+            weights.push_back(weight);
+            cumulativeWeights.push_back(cumulative);
+        }
+        offsets.push_back(elements.size());
+        return wheelCount() - 1;
+    }
+
+    /**
+     * @brief Changes the weight of one region in O(wheel size)
+     * @param wheel The wheel
+     * @param slot The region's position within the wheel
+     * @param weight The new weight
+     * @throws std::out_of_range if wheel or slot is out of range
+     * @throws std::invalid_argument if weight is negative or zero
+     */
+    void setWeight(WheelId wheel, size_t slot, W weight) {
+        const size_t index = regionIndex(wheel, slot, "setWeight");
+        validateWeight(weight, "setWeight");
+
+        weights[index] = weight;
+        W cumulative = index == offsets[wheel] ? W{0} : cumulativeWeights[index - 1];
+        for (size_t i = index; i < offsets[wheel + 1]; ++i) {
+            cumulative += weights[i];
+            cumulativeWeights[i] = cumulative;
+        }
+    }
+
+    /**
+     * @brief Reserves storage for a number of wheels and regions
+     * @param wheels Expected number of wheels
+     * @param regions Expected number of regions across all wheels
+     */
+    void reserve(size_t wheels, size_t regions) {
+        offsets.reserve(wheels + 1);
+        elements.reserve(regions);
+        weights.reserve(regions);
+        cumulativeWeights.reserve(regions);
+    }
+
+    /**
+     * @brief Removes every wheel
+     */
+    void clear() {
+        offsets.assign(1, 0);
+        elements.clear();
+        weights.clear();
+        cumulativeWeights.clear();
+    }
+
+    /*** Query Methods ***/
+
+    /**
+     * @brief Checks if the pool has no wheels
+     * @return true if empty, false otherwise
+     */
+    bool empty() const {
+        return wheelCount() == 0;
+    }
+
+    /**
+     * @brief Gets the number of wheels in the pool
+     * @return Number of wheels
+     */
+    size_t wheelCount() const {
+        return offsets.size() - 1;
+    }
+
+    /**
+     * @brief Gets the number of regions across all wheels
+     * @return Number of regions
+     */
+    size_t size() const {
+        return elements.size();
+    }
+
+    /**
+     * @brief Gets the number of regions in one wheel
+     * @param wheel The wheel
+     * @return Number of regions
+     * @throws std::out_of_range if wheel is not a wheel of this pool
+     */
+    size_t wheelSize(WheelId wheel) const {
+        checkWheel(wheel, "wheelSize");
+        return offsets[wheel + 1] - offsets[wheel];
+    }
+
+    /**
+     * @brief Gets the element of one region
+     * @param wheel The wheel
+     * @param slot The region's position within the wheel
+     * @return The element
+     * @throws std::out_of_range if wheel or slot is out of range
+     */
+    const E& getElement(WheelId wheel, size_t slot) const {
+        return elements[regionIndex(wheel, slot, "getElement")];
+    }
+
+    /**
+     * @brief Gets the weight of one region
+     * @param wheel The wheel
+     * @param slot The region's position within the wheel
+     * @return The weight
+     * @throws std::out_of_range if wheel or slot is out of range
+     */
+    W getWeight(WheelId wheel, size_t slot) const {
+        return weights[regionIndex(wheel, slot, "getWeight")];
+    }
+
+    /**
+     * @brief Gets the sum of one wheel's weights
+     * @param wheel The wheel
+     * @return Total weight
+     * @throws std::out_of_range if wheel is not a wheel of this pool
+     */
+    W getTotalWeight(WheelId wheel) const {
+        checkWheel(wheel, "getTotalWeight");
+        return cumulativeWeights[offsets[wheel + 1] - 1];
+    }
+
+    /**
+     * @brief Calculates the selection probability of one region
+     * @param wheel The wheel
+     * @param slot The region's position within the wheel
+     * @return Probability fraction (0.0 to 1.0)
+     * @throws std::out_of_range if wheel or slot is out of range
+     */
+    double getSelectionProbability(WheelId wheel, size_t slot) const {
+        return static_cast<double>(getWeight(wheel, slot)) / static_cast<double>(getTotalWeight(wheel));
+    }
+
+    /**
+     * @brief Seeds the shared random number generator for the current thread.
+     * @param seed The seed value
+     * @note The engine is shared by all wheels on the calling thread.
+     */
+    void seedRandom(unsigned int seed) {
+        WheelRandom::seed(seed);
+    }
+
+private:
+    /// Wheels with at most this many regions are searched by counting instead of bisecting
+    static constexpr size_t maximumCountedSize = 32;
+
+    /*** Member Variables ***/
+    std::vector<size_t> offsets{0};  ///< Wheel i owns regions [offsets[i], offsets[i + 1])
+    std::vector<E> elements;
+    std::vector<W> weights;
+    std::vector<W> cumulativeWeights; ///< Running sums that restart at each wheel
+
+    /*** Private Helper Methods ***/
+
+    /**
+     * @brief Draws a region index from the wheel occupying [begin, end)
+     * @return The selected region's index into the shared arrays
+     */
+    size_t selectSlot(size_t begin, size_t end) const {
+        const W* sums = cumulativeWeights.data() + begin;
+        const size_t count = end - begin;
+        const W target = WheelRandom::weightBelow(sums[count - 1]);
+
+        if (count > maximumCountedSize) {
+            const size_t slot = std::upper_bound(sums, sums + count, target) - sums;
+            return begin + std::min(slot, count - 1);
+        }
+
+        // The selected slot is the number of running sums at or below the target
+        size_t slot = 0;
+        for (size_t i = 0; i + 1 < count; ++i) {
+            slot += sums[i] <= target;
+        }
+        return begin + slot;
+    }
+
+    size_t regionIndex(WheelId wheel, size_t slot, const char* caller) const {
+        checkWheel(wheel, caller);
+        if (slot >= offsets[wheel + 1] - offsets[wheel]) {
+            std::ostringstream msg;
+            msg << "WheelPool::" << caller << ": slot " << slot << " is out of range for wheel " << wheel;
+            throw std::out_of_range(msg.str());
+        }
+        return offsets[wheel] + slot;
+    }
+
+    void checkWheel(WheelId wheel, const char* caller) const {
+        if (wheel >= wheelCount()) {
+            std::ostringstream msg;
+            msg << "WheelPool::" << caller << ": unknown wheel " << wheel;
+            throw std::out_of_range(msg.str());
+        }
+    }
+
+    static void validateWeight(W weight, const char* caller) {
+        if (weight <= 0) {
+            std::ostringstream msg;
+            msg << "WheelPool::" << caller << ": weight must be positive, got " << weight;
+            throw std::invalid_argument(msg.str());
+        }
+    }
+};
@@ -0,0 +1,284 @@
+#include "../RouletteWheel.hpp"
+#include "../CatalogRouletteWheel.hpp"
+#include <benchmark/benchmark.h>
+#include <atomic>
+#include <cstddef>
+#include <cstdlib>
+#include <memory_resource>
+#include <new>
+#include <string>
+#include <vector>
+
+// Global allocation counters. Replacing operator new affects the whole benchmark binary,
+// but the cost is two relaxed increments per allocation.
+static std::atomic<size_t> allocationCount{0};
+static std::atomic<size_t> allocatedBytes{0};
+
+void* operator new(std::size_t size) {
+    allocationCount.fetch_add(1, std::memory_order_relaxed);
+    allocatedBytes.fetch_add(size, std::memory_order_relaxed);
+    if (void* pointer = std::malloc(size == 0 ? 1 : size)) {
+        return pointer;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void* pointer) noexcept {
+    std::free(pointer);
+}
+
+void operator delete(void* pointer, std::size_t) noexcept {
+    std::free(pointer);
+}
+
+// Element names are long enough to defeat the small-string optimisation,
+// so every string copy shows up as an allocation.
+static std::vector<std::string> makeLongNames(int count) {
+    std::vector<std::string> names;
+    names.reserve(count);
+    for (int i = 0; i < count; ++i) {
+        names.push_back("Loot table entry with a long name #" + std::to_string(i));
+    }
+    return names;
+}
+
+// Benchmark: addRegion(const E&) copies every string element into the wheel
+static void BM_AllocationsAddRegionCopy(benchmark::State& state) {
+    const int numElements = state.range(0);
+    size_t allocations = 0;
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        std::vector<std::string> names = makeLongNames(numElements);
+        RouletteWheel<std::string, int> wheel;
+        wheel.reserve(numElements);
+        const size_t before = allocationCount.load(std::memory_order_relaxed);
+        state.ResumeTiming();
+
+        for (int i = 0; i < numElements; ++i) {
+            wheel.addRegion(names[i], 100);
+        }
+
+        state.PauseTiming();
+        allocations += allocationCount.load(std::memory_order_relaxed) - before;
+        benchmark::DoNotOptimize(wheel);
+        state.ResumeTiming();
+    }
+
+    state.counters["allocs_per_add"] = benchmark::Counter(
+        static_cast<double>(allocations) / static_cast<double>(state.iterations() * numElements));
+    state.SetItemsProcessed(state.iterations() * numElements);
+}
+BENCHMARK(BM_AllocationsAddRegionCopy)->Range(8, 512)->Arg(4096);
+
+// Benchmark: addRegion(E&&) moves every string element into the wheel
+static void BM_AllocationsAddRegionMove(benchmark::State& state) {
+    const int numElements = state.range(0);
+    size_t allocations = 0;
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        std::vector<std::string> names = makeLongNames(numElements);
+        RouletteWheel<std::string, int> wheel;
+        wheel.reserve(numElements);
+        const size_t before = allocationCount.load(std::memory_order_relaxed);
+        state.ResumeTiming();
+
+        for (int i = 0; i < numElements; ++i) {
+            wheel.addRegion(std::move(names[i]), 100);
+        }
+
+        state.PauseTiming();
+        allocations += allocationCount.load(std::memory_order_relaxed) - before;
+        benchmark::DoNotOptimize(wheel);
+        state.ResumeTiming();
+    }
+
+    state.counters["allocs_per_add"] = benchmark::Counter(
+        static_cast<double>(allocations) / static_cast<double>(state.iterations() * numElements));
+    state.SetItemsProcessed(state.iterations() * numElements);
+}
+BENCHMARK(BM_AllocationsAddRegionMove)->Range(8, 512)->Arg(4096);
+
+// Benchmark: emplaceRegion constructs each element directly in wheel storage
+static void BM_AllocationsEmplaceRegion(benchmark::State& state) {
+    const int numElements = state.range(0);
+    const std::vector<std::string> names = makeLongNames(numElements);
+    size_t allocations = 0;
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        RouletteWheel<std::string, int> wheel;
+        wheel.reserve(numElements);
+        const size_t before = allocationCount.load(std::memory_order_relaxed);
+        state.ResumeTiming();
+
+        for (int i = 0; i < numElements; ++i) {
+            wheel.emplaceRegion(100, names[i].data(), names[i].size());
+        }
+
+        state.PauseTiming();
+        // One allocation per element is the string's own buffer; anything above that is overhead
+        allocations += allocationCount.load(std::memory_order_relaxed) - before - numElements;
+        benchmark::DoNotOptimize(wheel);
+        state.ResumeTiming();
+    }
+
+    state.counters["extra_allocs_per_add"] = benchmark::Counter(
+        static_cast<double>(allocations) / static_cast<double>(state.iterations() * numElements));
+    state.SetItemsProcessed(state.iterations() * numElements);
+}
+BENCHMARK(BM_AllocationsEmplaceRegion)->Range(8, 512)->Arg(4096);
+
+// Benchmark: selectAndRemove moves string elements out of the wheel
+static void BM_AllocationsSelectAndRemove(benchmark::State& state) {
+    const int numElements = state.range(0);
+    size_t allocations = 0;
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        std::vector<std::string> names = makeLongNames(numElements);
+        RouletteWheel<std::string, int> wheel;
+        for (int i = 0; i < numElements; ++i) {
+            wheel.addRegion(std::move(names[i]), 100);
+        }
+        const size_t before = allocationCount.load(std::memory_order_relaxed);
+        state.ResumeTiming();
+
+        while (!wheel.empty()) {
+            std::string removed = wheel.selectAndRemove();
+            benchmark::DoNotOptimize(removed);
+        }
+
+        state.PauseTiming();
+        allocations += allocationCount.load(std::memory_order_relaxed) - before;
+        state.ResumeTiming();
+    }
+
+    state.counters["allocs_per_remove"] = benchmark::Counter(
+        static_cast<double>(allocations) / static_cast<double>(state.iterations() * numElements));
+    state.SetItemsProcessed(state.iterations() * numElements);
+}
+BENCHMARK(BM_AllocationsSelectAndRemove)->Range(8, 512)->Arg(4096);
+
+// Builds a small per-entity wheel the way a simulation tick would
+template<typename Wheel>
+static void buildTickWheel(Wheel& wheel, int entity) {
+    for (int action = 0; action < 6; ++action) {
+        wheel.addRegion(action, 1 + (entity + action) % 7);
+    }
+}
+
+// Benchmark: 100k short-lived wheels per tick on the global heap
+static void BM_TickWheelsGlobalHeap(benchmark::State& state) {
+    const int numWheels = state.range(0);
+    size_t allocations = 0;
+
+    for (auto _ : state) {
+        const size_t before = allocationCount.load(std::memory_order_relaxed);
+        for (int entity = 0; entity < numWheels; ++entity) {
+            RouletteWheel<int, int> wheel;
+            buildTickWheel(wheel, entity);
+            benchmark::DoNotOptimize(wheel.select());
+        }
+        allocations += allocationCount.load(std::memory_order_relaxed) - before;
+    }
+
+    state.counters["allocs_per_wheel"] = benchmark::Counter(
+        static_cast<double>(allocations) / static_cast<double>(state.iterations() * numWheels));
+    state.SetItemsProcessed(state.iterations() * numWheels);
+}
+BENCHMARK(BM_TickWheelsGlobalHeap)->Arg(100000)->Unit(benchmark::kMillisecond);
+
+// Benchmark: 100k short-lived wheels per tick backed by a monotonic arena released each tick
+static void BM_TickWheelsArena(benchmark::State& state) {
+    const int numWheels = state.range(0);
+    std::vector<std::byte> buffer(16 << 20);
+    std::pmr::monotonic_buffer_resource arena(buffer.data(), buffer.size());
+    size_t allocations = 0;
+
+    for (auto _ : state) {
+        const size_t before = allocationCount.load(std::memory_order_relaxed);
+        for (int entity = 0; entity < numWheels; ++entity) {
+            PmrRouletteWheel<int, int> wheel(&arena);
+            wheel.reserve(6);
+            buildTickWheel(wheel, entity);
+            benchmark::DoNotOptimize(wheel.select());
+        }
+        arena.release();
+        allocations += allocationCount.load(std::memory_order_relaxed) - before;
+    }
+
+    state.counters["allocs_per_wheel"] = benchmark::Counter(
+        static_cast<double>(allocations) / static_cast<double>(state.iterations() * numWheels));
+    state.SetItemsProcessed(state.iterations() * numWheels);
+}
+BENCHMARK(BM_TickWheelsArena)->Arg(100000)->Unit(benchmark::kMillisecond);
+
+// 10k wheels, each holding 100 of the same 1k long-named items with its own weights
+static constexpr int catalogSize = 1000;
+static constexpr int catalogWheelSize = 100;
+
+static int catalogItemFor(int wheel, int slot) {
+    return (wheel * 37 + slot * 10) % catalogSize;
+}
+
+// Benchmark: Build wheels that each store a copy of every item
+static void BM_OwningWheelsConstruction(benchmark::State& state) {
+    const int numWheels = state.range(0);
+    const std::vector<std::string> items = makeLongNames(catalogSize);
+    size_t bytes = 0;
+
+    for (auto _ : state) {
+        const size_t before = allocatedBytes.load(std::memory_order_relaxed);
+        std::vector<RouletteWheel<std::string, int>> wheels(numWheels);
+        for (int wheel = 0; wheel < numWheels; ++wheel) {
+            wheels[wheel].reserve(catalogWheelSize);
+            for (int slot = 0; slot < catalogWheelSize; ++slot) {
+                wheels[wheel].addRegion(items[catalogItemFor(wheel, slot)], 1 + slot);
+            }
+        }
+        bytes += allocatedBytes.load(std::memory_order_relaxed) - before;
+
+        state.PauseTiming();
+        benchmark::DoNotOptimize(wheels.data());
+        wheels.clear();
+        state.ResumeTiming();
+    }
+
+    state.counters["bytes_per_wheel"] = benchmark::Counter(
+        static_cast<double>(bytes) / static_cast<double>(state.iterations() * numWheels));
+    state.SetItemsProcessed(state.iterations() * numWheels);
+}
+BENCHMARK(BM_OwningWheelsConstruction)->Arg(10000)->Unit(benchmark::kMillisecond);
+
+// Benchmark: Build the same wheels over a shared catalog, storing only item ids
+static void BM_CatalogWheelsConstruction(benchmark::State& state) {
+    const int numWheels = state.range(0);
+    const auto catalog = WheelCatalog<std::string>::create(makeLongNames(catalogSize));
+    size_t bytes = 0;
+
+    for (auto _ : state) {
+        const size_t before = allocatedBytes.load(std::memory_order_relaxed);
+        std::vector<CatalogRouletteWheel<std::string, int>> wheels;
+        wheels.reserve(numWheels);
+        for (int wheel = 0; wheel < numWheels; ++wheel) {
+            wheels.emplace_back(catalog);
+            wheels.back().reserve(catalogWheelSize);
+            for (int slot = 0; slot < catalogWheelSize; ++slot) {
+                wheels.back().addRegion(catalogItemFor(wheel, slot), 1 + slot);
+            }
+        }
+        bytes += allocatedBytes.load(std::memory_order_relaxed) - before;
+
+        state.PauseTiming();
+        benchmark::DoNotOptimize(wheels.data());
+        wheels.clear();
+        state.ResumeTiming();
+    }
+
+    state.counters["bytes_per_wheel"] = benchmark::Counter(
+        static_cast<double>(bytes) / static_cast<double>(state.iterations() * numWheels));
+    state.SetItemsProcessed(state.iterations() * numWheels);
+}
+BENCHMARK(BM_CatalogWheelsConstruction)->Arg(10000)->Unit(benchmark::kMillisecond);
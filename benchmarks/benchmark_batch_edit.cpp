@@ -0,0 +1,74 @@
+#include "../RouletteWheel.hpp"
+#include <benchmark/benchmark.h>
+
+// 10k edits against a 20k-region wheel: a quarter removals, the rest appends and weight
+// increases, followed by one draw so the engine's cache rebuild is part of the cost
+static constexpr int editCount = 10000;
+
+static RouletteWheel<int, double> editBaseWheel(WheelStrategy strategy) {
+    RouletteWheel<int, double> wheel(RouletteWheel<int, double>::Options{true, strategy});
+    for (int i = 0; i < 2 * editCount; ++i) {
+        wheel.addRegion(i, 1.0 + i % 7);
+    }
+    wheel.select();
+    return wheel;
+}
+
+template<typename Target>
+static void applyEdits(Target& target) {
+    for (int i = 0; i < editCount; ++i) {
+        switch (i % 4) {
+            case 0: target.removeElement(2 * i); break;
+            case 1: target.addRegion(2 * i, 2.0); break;
+            default: target.addRegion(2 * editCount + i, 1.0); break;
+        }
+    }
+}
+
+static void BM_BatchEdit_Individually(benchmark::State& state) {
+    const auto base = editBaseWheel(static_cast<WheelStrategy>(state.range(0)));
+    for (auto _ : state) {
+        state.PauseTiming();
+        auto wheel = base;
+        state.ResumeTiming();
+        applyEdits(wheel);
+        benchmark::DoNotOptimize(wheel.select());
+    }
+    state.SetItemsProcessed(state.iterations() * editCount);
+}
+BENCHMARK(BM_BatchEdit_Individually)
+    ->Arg(static_cast<int>(WheelStrategy::PrefixSum))
+    ->Arg(static_cast<int>(WheelStrategy::AliasTable))
+    ->Unit(benchmark::kMillisecond);
+
+static void BM_BatchEdit_Batched(benchmark::State& state) {
+    const auto base = editBaseWheel(static_cast<WheelStrategy>(state.range(0)));
+    for (auto _ : state) {
+        state.PauseTiming();
+        auto wheel = base;
+        state.ResumeTiming();
+        wheel.edit([](auto& tx) { applyEdits(tx); });
+        benchmark::DoNotOptimize(wheel.select());
+    }
+    state.SetItemsProcessed(state.iterations() * editCount);
+}
+BENCHMARK(BM_BatchEdit_Batched)
+    ->Arg(static_cast<int>(WheelStrategy::PrefixSum))
+    ->Arg(static_cast<int>(WheelStrategy::AliasTable))
+    ->Unit(benchmark::kMillisecond);
+
+// Interleaving a draw with every edit forces the pinned engine to rebuild each time
+static void BM_BatchEdit_IndividuallyWithDraws(benchmark::State& state) {
+    const auto base = editBaseWheel(WheelStrategy::AliasTable);
+    for (auto _ : state) {
+        state.PauseTiming();
+        auto wheel = base;
+        state.ResumeTiming();
+        for (int i = 0; i < editCount; ++i) {
+            wheel.addRegion(i, 1.0);
+            benchmark::DoNotOptimize(wheel.select());
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * editCount);
+}
+BENCHMARK(BM_BatchEdit_IndividuallyWithDraws)->Unit(benchmark::kMillisecond)->Iterations(2);
@@ -0,0 +1,74 @@
+#include "../CowRouletteWheel.hpp"
+#include "../RouletteWheel.hpp"
+#include <benchmark/benchmark.h>
+#include <vector>
+
+static constexpr int baseRegions = 1000;
+
+static RouletteWheel<int, int> makeBaseWheel() {
+    RouletteWheel<int, int> base;
+    for (int i = 0; i < baseRegions; ++i) {
+        base.addRegion(i, 1 + i % 50);
+    }
+    return base;
+}
+
+// Zone z tweaks 1 to 5 spawn weights
+static int overrideCount(int zone) {
+    return 1 + zone % 5;
+}
+
+static int overriddenElement(int zone, int edit) {
+    return (zone * 31 + edit * 197) % baseRegions;
+}
+
+// Benchmark: 10k zone variants as copy-on-write wheels, one draw each
+static void BM_CowWheelVariants(benchmark::State& state) {
+    const int numZones = state.range(0);
+    const CowRouletteWheel<int, int> base(makeBaseWheel());
+
+    for (auto _ : state) {
+        std::vector<CowRouletteWheel<int, int>> zones(numZones, base);
+        for (int zone = 0; zone < numZones; ++zone) {
+            for (int edit = 0; edit < overrideCount(zone); ++edit) {
+                zones[zone].addRegion(overriddenElement(zone, edit), 25);
+            }
+            benchmark::DoNotOptimize(zones[zone].select());
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() * numZones);
+}
+BENCHMARK(BM_CowWheelVariants)->Arg(10000)->Unit(benchmark::kMillisecond);
+
+// Benchmark: The same variants as deep copies of the base RouletteWheel
+static void BM_DeepCopyVariants(benchmark::State& state) {
+    const int numZones = state.range(0);
+    const RouletteWheel<int, int> base = makeBaseWheel();
+
+    for (auto _ : state) {
+        std::vector<RouletteWheel<int, int>> zones(numZones, base);
+        for (int zone = 0; zone < numZones; ++zone) {
+            for (int edit = 0; edit < overrideCount(zone); ++edit) {
+                zones[zone].addRegion(overriddenElement(zone, edit), 25);
+            }
+            benchmark::DoNotOptimize(zones[zone].select());
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() * numZones);
+}
+BENCHMARK(BM_DeepCopyVariants)->Arg(10000)->Unit(benchmark::kMillisecond);
+
+// Benchmark: Repeated draws from one variant with 5 overrides
+static void BM_CowWheelSelect(benchmark::State& state) {
+    CowRouletteWheel<int, int> zone(makeBaseWheel());
+    for (int edit = 0; edit < 5; ++edit) {
+        zone.addRegion(overriddenElement(4, edit), 25);
+    }
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(zone.select());
+    }
+}
+BENCHMARK(BM_CowWheelSelect);
@@ -0,0 +1,71 @@
+#include "../WheelCsvReader.hpp"
+#include <benchmark/benchmark.h>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <unordered_map>
+
+// 64 MB stands in for production-sized tables; throughput is per byte, so it scales
+static constexpr size_t targetFileBytes = size_t{64} << 20;
+
+static const std::string& csvPath() {
+    static const std::string path = [] {
+        const auto file = std::filesystem::temp_directory_path() / "roulette_wheel_weights.csv";
+        std::ofstream out(file, std::ios::binary);
+        size_t written = 0;
+        for (size_t i = 0; written < targetFileBytes; ++i) {
+            const std::string line = "item_" + std::to_string(i) + "," + std::to_string(1 + i % 997) + ".25\n";
+            out << line;
+            written += line.size();
+        }
+        return file.string();
+    }();
+    return path;
+}
+
+// Every record is looked up before it is added, so the wheels index their elements
+static RouletteWheel<std::string, double>::Options indexedOptions() {
+    RouletteWheel<std::string, double>::Options options;
+    options.indexElements = true;
+    return options;
+}
+
+static void BM_CsvReader_Stream(benchmark::State& state) {
+    const std::string& path = csvPath();
+    for (auto _ : state) {
+        std::ifstream in(path, std::ios::binary);
+        RouletteWheel<std::string, double> wheel(indexedOptions());
+        benchmark::DoNotOptimize(WheelCsvReader().read(in, wheel).recordsAdded);
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * std::filesystem::file_size(path)));
+}
+BENCHMARK(BM_CsvReader_Stream)->Unit(benchmark::kMillisecond);
+
+static void BM_CsvReader_MappedFile(benchmark::State& state) {
+    const std::string& path = csvPath();
+    for (auto _ : state) {
+        const MappedFile file(path);
+        RouletteWheel<std::string, double> wheel(indexedOptions());
+        benchmark::DoNotOptimize(WheelCsvReader().read(file, wheel).recordsAdded);
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * std::filesystem::file_size(path)));
+}
+BENCHMARK(BM_CsvReader_MappedFile)->Unit(benchmark::kMillisecond);
+
+// The idiom the reader replaces: parse every line into a map, then build the wheel from it
+static void BM_CsvReader_MapThenConstruct(benchmark::State& state) {
+    const std::string& path = csvPath();
+    for (auto _ : state) {
+        std::ifstream in(path, std::ios::binary);
+        std::unordered_map<std::string, double> weights;
+        std::string line;
+        while (std::getline(in, line)) {
+            const size_t comma = line.find(',');
+            weights[line.substr(0, comma)] += std::stod(line.substr(comma + 1));
+        }
+        RouletteWheel<std::string, double> wheel(weights, indexedOptions());
+        benchmark::DoNotOptimize(wheel.size());
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * std::filesystem::file_size(path)));
+}
+BENCHMARK(BM_CsvReader_MapThenConstruct)->Unit(benchmark::kMillisecond);
@@ -0,0 +1,55 @@
+#include "../DecayingRouletteWheel.hpp"
+#include "../RouletteWheel.hpp"
+#include <benchmark/benchmark.h>
+#include <cmath>
+#include <vector>
+
+static constexpr double frameTime = 1.0 / 60.0;
+static constexpr double decayRate = 0.5;
+
+// Benchmark: One frame on 100k decaying regions - advance time, bump the drawn region, draw
+static void BM_DecayingWheelFrame(benchmark::State& state) {
+    const int numElements = state.range(0);
+    DecayingRouletteWheel<int> wheel(decayRate);
+    for (int i = 0; i < numElements; ++i) {
+        wheel.addRegion(i, 1.0 + i % 13);
+    }
+
+    for (auto _ : state) {
+        wheel.advanceBy(frameTime);
+        const int drawn = wheel.select();
+        wheel.addRegion(drawn, 1.0);
+        benchmark::DoNotOptimize(drawn);
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_DecayingWheelFrame)->Arg(100000);
+
+// Benchmark: The same frame done eagerly, decaying every stored weight before the draw
+static void BM_EagerDecayFrame(benchmark::State& state) {
+    const int numElements = state.range(0);
+    std::vector<double> weights(numElements);
+    RouletteWheel<int, double> wheel;
+    for (int i = 0; i < numElements; ++i) {
+        weights[i] = 1.0 + i % 13;
+        wheel.addRegion(i, weights[i]);
+    }
+    const double factor = std::exp(-decayRate * frameTime);
+
+    for (auto _ : state) {
+        // Rewrite every weight, then rebuild the wheel the draw is made from
+        RouletteWheel<int, double> frameWheel;
+        frameWheel.reserve(numElements);
+        for (int i = 0; i < numElements; ++i) {
+            weights[i] *= factor;
+            frameWheel.addRegion(i, weights[i]);
+        }
+        const int drawn = frameWheel.select();
+        weights[drawn] += 1.0;
+        benchmark::DoNotOptimize(drawn);
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_EagerDecayFrame)->Arg(100000);
@@ -0,0 +1,56 @@
+#include "../DepletableRouletteWheel.hpp"
+#include "../RouletteWheel.hpp"
+#include <benchmark/benchmark.h>
+#include <string>
+#include <tuple>
+#include <vector>
+
+// Card names long enough to defeat the small-string optimisation, so copies allocate
+static std::vector<std::tuple<std::string, double>> deckCards(int size, bool weighted) {
+    std::vector<std::tuple<std::string, double>> cards;
+    cards.reserve(size);
+    for (int i = 0; i < size; ++i) {
+        cards.emplace_back("card number " + std::to_string(i) + " of the deck", weighted ? 1.0 + i % 5 : 1.0);
+    }
+    return cards;
+}
+
+// One cycle: draw every card, then reset
+static void BM_Depletable_DrainAndReset(benchmark::State& state) {
+    const int size = static_cast<int>(state.range(0));
+    DepletableRouletteWheel<std::string, double> deck(deckCards(size, state.range(1) != 0));
+    for (auto _ : state) {
+        while (!deck.empty()) {
+            benchmark::DoNotOptimize(&deck.selectAndRemove());
+        }
+        deck.reset();
+    }
+    state.SetItemsProcessed(state.iterations() * size);
+}
+BENCHMARK(BM_Depletable_DrainAndReset)->Args({52, 0})->Args({52, 1})->Args({10000, 0})->Args({10000, 1});
+
+// Partial hands: draw 5 cards, then reset
+static void BM_Depletable_DrawHandAndReset(benchmark::State& state) {
+    DepletableRouletteWheel<std::string, double> deck(deckCards(static_cast<int>(state.range(0)), state.range(1) != 0));
+    for (auto _ : state) {
+        for (int card = 0; card < 5; ++card) {
+            benchmark::DoNotOptimize(&deck.selectAndRemove());
+        }
+        deck.reset();
+    }
+}
+BENCHMARK(BM_Depletable_DrawHandAndReset)->Args({52, 0})->Args({52, 1})->Args({10000, 0})->Args({10000, 1});
+
+// The idiom the depletable wheel replaces: drain with selectAndRemove, rebuild to reshuffle
+static void BM_Depletable_RouletteWheelDrainAndRebuild(benchmark::State& state) {
+    const int size = static_cast<int>(state.range(0));
+    const auto cards = deckCards(size, state.range(1) != 0);
+    for (auto _ : state) {
+        RouletteWheel<std::string, double> deck(cards);
+        while (!deck.empty()) {
+            benchmark::DoNotOptimize(deck.selectAndRemove());
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * size);
+}
+BENCHMARK(BM_Depletable_RouletteWheelDrainAndRebuild)->Args({52, 0})->Args({52, 1})->Args({10000, 0})->Args({10000, 1});
@@ -0,0 +1,85 @@
+#include "../FrozenRouletteWheel.hpp"
+#include "../RouletteWheel.hpp"
+#include <benchmark/benchmark.h>
+#include <array>
+#include <string_view>
+#include <utility>
+
+static constexpr auto frozenWeather = makeFrozenRouletteWheel<std::string_view, int>({
+    {"Sunny", 50}, {"Cloudy", 30}, {"Rainy", 15}, {"Stormy", 5}
+});
+
+// 64-entry table with skewed integer weights, built at compile time
+static constexpr std::array<std::pair<int, int>, 64> makeLargeTable() {
+    std::array<std::pair<int, int>, 64> table{};
+    for (int i = 0; i < 64; ++i) {
+        table[i].first = i;
+        table[i].second = 1 + (i * 37) % 100;
+    }
+    return table;
+}
+static constexpr FrozenRouletteWheel<int, int, 64> frozenLarge{makeLargeTable()};
+
+// Benchmark: Selection from a compile-time weather table
+static void BM_FrozenWheelSelectSmall(benchmark::State& state) {
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(frozenWeather.select());
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_FrozenWheelSelectSmall);
+
+// Benchmark: Selection from the same table built at runtime
+static void BM_RuntimeWheelSelectSmall(benchmark::State& state) {
+    RouletteWheel<std::string_view, int> wheel;
+    wheel.addRegion("Sunny", 50);
+    wheel.addRegion("Cloudy", 30);
+    wheel.addRegion("Rainy", 15);
+    wheel.addRegion("Stormy", 5);
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(wheel.select());
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_RuntimeWheelSelectSmall);
+
+// Benchmark: Selection from a compile-time 64-entry table
+static void BM_FrozenWheelSelectLarge(benchmark::State& state) {
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(frozenLarge.select());
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_FrozenWheelSelectLarge);
+
+// Benchmark: Selection from the same 64-entry table built at runtime
+static void BM_RuntimeWheelSelectLarge(benchmark::State& state) {
+    RouletteWheel<int, int> wheel;
+    for (const auto& [element, weight] : makeLargeTable()) {
+        wheel.addRegion(element, weight);
+    }
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(wheel.select());
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_RuntimeWheelSelectLarge);
+
+// Benchmark: Building the weather table at runtime (the cost a frozen wheel avoids)
+static void BM_RuntimeWheelConstructionSmall(benchmark::State& state) {
+    for (auto _ : state) {
+        RouletteWheel<std::string_view, int> wheel;
+        wheel.addRegion("Sunny", 50);
+        wheel.addRegion("Cloudy", 30);
+        wheel.addRegion("Rainy", 15);
+        wheel.addRegion("Stormy", 5);
+        benchmark::DoNotOptimize(wheel.select());
+    }
+}
+BENCHMARK(BM_RuntimeWheelConstructionSmall);
@@ -0,0 +1,90 @@
+#include "../FrozenWheelView.hpp"
+#include "../RouletteWheel.hpp"
+#include <benchmark/benchmark.h>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <tuple>
+#include <vector>
+
+static constexpr int numTables = 500;
+static constexpr int regionsPerTable = 2000;
+
+static std::filesystem::path tableDirectory() {
+    return std::filesystem::temp_directory_path() / "roulette_wheel_frozen_tables";
+}
+
+static std::string tablePath(int table, const char* extension) {
+    return (tableDirectory() / ("table" + std::to_string(table) + extension)).string();
+}
+
+// Writes every table twice: as a frozen image and as raw (id, weight) records
+static void writeTables() {
+    static bool written = false;
+    if (written) {
+        return;
+    }
+    std::filesystem::create_directories(tableDirectory());
+    for (int table = 0; table < numTables; ++table) {
+        std::vector<std::tuple<std::uint32_t, double>> regions;
+        for (int i = 0; i < regionsPerTable; ++i) {
+            regions.emplace_back(static_cast<std::uint32_t>(i), 1.0 + (table + i) % 97);
+        }
+
+        std::ofstream image(tablePath(table, ".frozen"), std::ios::binary);
+        FrozenWheelView::write(image, regions);
+
+        std::ofstream records(tablePath(table, ".records"), std::ios::binary);
+        for (const auto& [id, weight] : regions) {
+            records.write(reinterpret_cast<const char*>(&id), sizeof(id));
+            records.write(reinterpret_cast<const char*>(&weight), sizeof(weight));
+        }
+    }
+    written = true;
+}
+
+// Benchmark: Map 500 frozen images and make the first draw from each
+static void BM_StartupMappedFrozenTables(benchmark::State& state) {
+    writeTables();
+
+    for (auto _ : state) {
+        std::vector<MappedFile> files;
+        files.reserve(numTables);
+        std::uint64_t checksum = 0;
+        for (int table = 0; table < numTables; ++table) {
+            files.emplace_back(tablePath(table, ".frozen"));
+            const FrozenWheelView view(files.back());
+            checksum += view.select();
+        }
+        benchmark::DoNotOptimize(checksum);
+    }
+
+    state.SetItemsProcessed(state.iterations() * numTables);
+}
+BENCHMARK(BM_StartupMappedFrozenTables)->Unit(benchmark::kMillisecond);
+
+// Benchmark: Read 500 tables record by record into wheels and make the first draw from each
+static void BM_StartupDeserializedTables(benchmark::State& state) {
+    writeTables();
+
+    for (auto _ : state) {
+        std::vector<RouletteWheel<std::uint32_t, double>> wheels(numTables);
+        std::uint64_t checksum = 0;
+        for (int table = 0; table < numTables; ++table) {
+            std::ifstream records(tablePath(table, ".records"), std::ios::binary);
+            std::uint32_t id = 0;
+            double weight = 0.0;
+            wheels[table].reserve(regionsPerTable);
+            while (records.read(reinterpret_cast<char*>(&id), sizeof(id))
+                   && records.read(reinterpret_cast<char*>(&weight), sizeof(weight))) {
+                wheels[table].addRegion(id, weight);
+            }
+            checksum += wheels[table].select();
+        }
+        benchmark::DoNotOptimize(checksum);
+    }
+
+    state.SetItemsProcessed(state.iterations() * numTables);
+}
+BENCHMARK(BM_StartupDeserializedTables)->Unit(benchmark::kMillisecond);
@@ -0,0 +1,122 @@
+#include "../HierarchicalRouletteWheel.hpp"
+#include "../RouletteWheel.hpp"
+#include <benchmark/benchmark.h>
+
+// A 3-level loot table: 10 rarity tiers x 100 categories x 100 items = 100k leaves
+static constexpr int rarityCount = 10;
+static constexpr int categoryCount = 100;
+static constexpr int itemCount = 100;
+
+static int leafWeight(int item) {
+    return item % 13 + 1;
+}
+
+static HierarchicalRouletteWheel<int, int> makeTieredTable() {
+    HierarchicalRouletteWheel<int, int> table;
+    int element = 0;
+    for (int rarity = 0; rarity < rarityCount; ++rarity) {
+        const auto rarityTier = table.addTier(table.root, (rarityCount - rarity) * 100);
+        for (int category = 0; category < categoryCount; ++category) {
+            const auto categoryTier = table.addTier(rarityTier);
+            for (int item = 0; item < itemCount; ++item, ++element) {
+                table.addElement(categoryTier, element, leafWeight(item));
+            }
+        }
+    }
+    return table;
+}
+
+// The same distribution flattened into one wheel, with each leaf's weight pre-multiplied by
+// its tier's share (rarity weight * category total is constant, so integers stay exact)
+static RouletteWheel<int, int> makeFlatTable() {
+    RouletteWheel<int, int>::Options options;
+    options.indexElements = true;  // BM_FlatRetuneTier looks up every item of a tier
+    RouletteWheel<int, int> table(options);
+    table.reserve(rarityCount * categoryCount * itemCount);
+    int element = 0;
+    for (int rarity = 0; rarity < rarityCount; ++rarity) {
+        for (int category = 0; category < categoryCount; ++category) {
+            for (int item = 0; item < itemCount; ++item, ++element) {
+                table.addRegion(element, (rarityCount - rarity) * leafWeight(item));
+            }
+        }
+    }
+    return table;
+}
+
+// Benchmark: Drawing from the nested table (three O(log k) descents)
+static void BM_HierarchicalSelect(benchmark::State& state) {
+    const HierarchicalRouletteWheel<int, int> table = makeTieredTable();
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(table.select());
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_HierarchicalSelect);
+
+// Benchmark: Drawing from the flattened table
+static void BM_FlatSelect(benchmark::State& state) {
+    RouletteWheel<int, int> table = makeFlatTable();
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(table.select());
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_FlatSelect);
+
+// Benchmark: Retuning one rarity tier's odds, then drawing
+static void BM_HierarchicalRetuneTier(benchmark::State& state) {
+    HierarchicalRouletteWheel<int, int> table = makeTieredTable();
+    int step = 0;
+
+    for (auto _ : state) {
+        const auto rarityTier = static_cast<HierarchicalRouletteWheel<int, int>::TierId>(1 + (step++ % rarityCount) * (categoryCount + 1));
+        table.setTierWeight(rarityTier, 50 + step % 100);
+        benchmark::DoNotOptimize(table.select());
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_HierarchicalRetuneTier);
+
+// Benchmark: Retuning one rarity tier in the flat table (every item in the tier is rescaled
+// by raising its multiplier by one)
+static void BM_FlatRetuneTier(benchmark::State& state) {
+    RouletteWheel<int, int> table = makeFlatTable();
+    int step = 0;
+
+    for (auto _ : state) {
+        const int first = (step++ % rarityCount) * categoryCount * itemCount;
+        for (int element = first; element < first + categoryCount * itemCount; ++element) {
+            table.addRegion(element, leafWeight(element % itemCount));
+        }
+        benchmark::DoNotOptimize(table.select());
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_FlatRetuneTier);
+
+// Benchmark: Reweighting elements of one wide tier (each tier indexes its elements, so the
+// lookup stays O(1) as the tier widens)
+static void BM_HierarchicalSetElementWeight(benchmark::State& state) {
+    const int width = static_cast<int>(state.range(0));
+    HierarchicalRouletteWheel<int, int> table;
+    const auto tier = table.addTier(table.root);
+    for (int element = 0; element < width; ++element) {
+        table.addElement(tier, element, leafWeight(element));
+    }
+    int step = 0;
+
+    for (auto _ : state) {
+        const int element = (step++ * 7919) % width;
+        benchmark::DoNotOptimize(table.setElementWeight(tier, element, leafWeight(step)));
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_HierarchicalSetElementWeight)->Range(64, 65536);
@@ -0,0 +1,112 @@
+#include "../LogitRouletteWheel.hpp"
+#include "../RouletteWheel.hpp"
+#include <benchmark/benchmark.h>
+#include <cmath>
+#include <vector>
+
+static double policyLogit(int action) {
+    return -0.01 * (action % 997);
+}
+
+// Benchmark: Nudge one action's log-probability, then draw
+static void BM_LogitWheelUpdateAndSelect(benchmark::State& state) {
+    const int numActions = state.range(0);
+    LogitRouletteWheel<int> wheel;
+    for (int i = 0; i < numActions; ++i) {
+        wheel.addRegion(i, policyLogit(i));
+    }
+
+    int step = 0;
+    for (auto _ : state) {
+        const int action = step++ % numActions;
+        wheel.setLogWeight(action, policyLogit(action + step));
+        benchmark::DoNotOptimize(wheel.select());
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_LogitWheelUpdateAndSelect)->Arg(1000)->Arg(100000);
+
+// Benchmark: The same update done by exponentiating every log-probability into a new wheel
+static void BM_ExpIntoRouletteWheel(benchmark::State& state) {
+    const int numActions = state.range(0);
+    std::vector<double> logits(numActions);
+    for (int i = 0; i < numActions; ++i) {
+        logits[i] = policyLogit(i);
+    }
+
+    int step = 0;
+    for (auto _ : state) {
+        const int action = step++ % numActions;
+        logits[action] = policyLogit(action + step);
+
+        RouletteWheel<int, double>::Options options;
+        options.indexElements = true;  // addRegion looks every action up first
+        RouletteWheel<int, double> wheel(options);
+        wheel.reserve(numActions);
+        for (int i = 0; i < numActions; ++i) {
+            wheel.addRegion(i, std::exp(logits[i]));
+        }
+        benchmark::DoNotOptimize(wheel.select());
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_ExpIntoRouletteWheel)->Arg(1000)->Arg(100000);
+
+// Benchmark: Replace the whole policy through the vectorisable batch path, then draw
+static void BM_LogitWheelSetLogWeights(benchmark::State& state) {
+    const int numActions = state.range(0);
+    LogitRouletteWheel<int> wheel;
+    std::vector<double> logits(numActions);
+    for (int i = 0; i < numActions; ++i) {
+        logits[i] = policyLogit(i);
+        wheel.addRegion(i, logits[i]);
+    }
+
+    int step = 0;
+    for (auto _ : state) {
+        logits[step++ % numActions] -= 0.001;
+        wheel.setLogWeights(logits.data(), logits.size());
+        benchmark::DoNotOptimize(wheel.select());
+    }
+
+    state.SetItemsProcessed(state.iterations() * numActions);
+}
+BENCHMARK(BM_LogitWheelSetLogWeights)->Arg(1000)->Arg(100000);
+
+// Benchmark: Gumbel-max draw, which reads the log-weights directly
+static void BM_LogitWheelGumbel(benchmark::State& state) {
+    const int numActions = state.range(0);
+    LogitRouletteWheel<int> wheel;
+    for (int i = 0; i < numActions; ++i) {
+        wheel.addRegion(i, policyLogit(i));
+    }
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(wheel.selectGumbel());
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_LogitWheelGumbel)->Arg(1000);
+
+// Benchmark: Batched draws from a fixed policy
+static void BM_LogitWheelSelectBatch(benchmark::State& state) {
+    const int numActions = static_cast<int>(state.range(0));
+    const size_t batchSize = state.range(1);
+    LogitRouletteWheel<int> wheel;
+    for (int i = 0; i < numActions; ++i) {
+        wheel.addRegion(i, policyLogit(i));
+    }
+    std::vector<int> draws(batchSize);
+
+    for (auto _ : state) {
+        wheel.selectBatch(batchSize, draws.begin());
+        benchmark::DoNotOptimize(draws.data());
+    }
+
+    state.SetItemsProcessed(state.iterations() * batchSize);
+}
+// The first two batches descend the tree per draw; the others bucket-sort and walk the weights once
+BENCHMARK(BM_LogitWheelSelectBatch)->Args({1000, 16})->Args({100000, 1024})->Args({1000, 1024})->Args({100000, 65536});
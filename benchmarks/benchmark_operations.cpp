@@ -1,6 +1,7 @@
 #include "../RouletteWheel.hpp"
 #include <benchmark/benchmark.h>
 #include <string>
+#include <vector>
 
 // Benchmark: AddRegion to empty wheel
 static void BM_AddRegionEmpty(benchmark::State& state) {
@@ -166,6 +167,61 @@ static void BM_RemoveInvalidRegionsNone(benchmark::State& state) {
 }
 BENCHMARK(BM_RemoveInvalidRegionsNone);
 
+// Benchmark: setWeight on a random element, then a draw (the engine keeps its cache in sync)
+static void BM_SetWeight(benchmark::State& state) {
+    const int size = static_cast<int>(state.range(0));
+    RouletteWheel<int, double> wheel;
+    for (int i = 0; i < size; ++i) {
+        wheel.addRegion(i, 1.0 + i % 7);
+    }
+
+    long long step = 0;
+    for (auto _ : state) {
+        const int element = static_cast<int>(step % size);
+        step += 7919;
+        wheel.setWeight(element, 1.0 + step % 13);
+        benchmark::DoNotOptimize(wheel.select());
+    }
+}
+BENCHMARK(BM_SetWeight)->Range(64, 10000);
+
+// Benchmark: setWeightAt on a random index, then a draw
+static void BM_SetWeightAt(benchmark::State& state) {
+    const int size = static_cast<int>(state.range(0));
+    RouletteWheel<int, double> wheel;
+    for (int i = 0; i < size; ++i) {
+        wheel.addRegion(i, 1.0 + i % 7);
+    }
+
+    long long step = 0;
+    for (auto _ : state) {
+        const size_t index = static_cast<size_t>(step % size);
+        step += 7919;
+        wheel.setWeightAt(index, 1.0 + step % 13);
+        benchmark::DoNotOptimize(wheel.select());
+    }
+}
+BENCHMARK(BM_SetWeightAt)->Range(64, 10000);
+
+// Benchmark: the idiom setWeight replaces - removeElement + addRegion, then a draw
+static void BM_SetWeightByRemoveAndAdd(benchmark::State& state) {
+    const int size = static_cast<int>(state.range(0));
+    RouletteWheel<int, double> wheel;
+    for (int i = 0; i < size; ++i) {
+        wheel.addRegion(i, 1.0 + i % 7);
+    }
+
+    long long step = 0;
+    for (auto _ : state) {
+        const int element = static_cast<int>(step % size);
+        step += 7919;
+        wheel.removeElement(element);
+        wheel.addRegion(element, 1.0 + step % 13);
+        benchmark::DoNotOptimize(wheel.select());
+    }
+}
+BENCHMARK(BM_SetWeightByRemoveAndAdd)->Range(64, 10000);
+
 // Benchmark: GetSelectionProbability (element exists)
 static void BM_GetSelectionProbabilityExists(benchmark::State& state) {
     RouletteWheel<int, int> wheel;
@@ -194,6 +250,55 @@ static void BM_GetSelectionProbabilityNotExists(benchmark::State& state) {
 }
 BENCHMARK(BM_GetSelectionProbabilityNotExists);
 
+// Drop-rate tables: the probability of every item in a 10k-item table with string names
+static RouletteWheel<std::string, double> dropRateTable() {
+    RouletteWheel<std::string, double> table;
+    for (int i = 0; i < 10000; ++i) {
+        table.addRegion("loot table item number " + std::to_string(i), 1.0 + i % 11);
+    }
+    return table;
+}
+
+// Benchmark: one getSelectionProbability element lookup per row
+static void BM_ProbabilityTablePerElement(benchmark::State& state) {
+    const auto table = dropRateTable();
+    std::vector<double> rates(table.size());
+    for (auto _ : state) {
+        for (size_t i = 0; i < rates.size(); ++i) {
+            rates[i] = table.getSelectionProbability(table.getRegions()[i].getElement());
+        }
+        benchmark::DoNotOptimize(rates.data());
+    }
+    state.SetItemsProcessed(state.iterations() * table.size());
+}
+BENCHMARK(BM_ProbabilityTablePerElement);
+
+// Benchmark: getSelectionProbabilityAt per row
+static void BM_ProbabilityTableByIndex(benchmark::State& state) {
+    const auto table = dropRateTable();
+    std::vector<double> rates(table.size());
+    for (auto _ : state) {
+        for (size_t i = 0; i < rates.size(); ++i) {
+            rates[i] = table.getSelectionProbabilityAt(i);
+        }
+        benchmark::DoNotOptimize(rates.data());
+    }
+    state.SetItemsProcessed(state.iterations() * table.size());
+}
+BENCHMARK(BM_ProbabilityTableByIndex);
+
+// Benchmark: the whole table in one probabilities() pass
+static void BM_ProbabilityTableBulk(benchmark::State& state) {
+    const auto table = dropRateTable();
+    std::vector<double> rates(table.size());
+    for (auto _ : state) {
+        table.probabilities(rates.data(), rates.size());
+        benchmark::DoNotOptimize(rates.data());
+    }
+    state.SetItemsProcessed(state.iterations() * table.size());
+}
+BENCHMARK(BM_ProbabilityTableBulk);
+
 // Benchmark: Empty check
 static void BM_Empty(benchmark::State& state) {
     RouletteWheel<int, int> wheel;
@@ -311,3 +416,63 @@ static void BM_CacheEffects(benchmark::State& state) {
     state.SetItemsProcessed(state.iterations() * numElements);
 }
 BENCHMARK(BM_CacheEffects)->Range(8, 2048);
+
+// The large wheels below are filled through addRegion, which looks each element up first
+static RouletteWheel<int, double>::Options indexedOptions() {
+    RouletteWheel<int, double>::Options options;
+    options.indexElements = true;
+    return options;
+}
+
+// Benchmark: Adaptive difficulty - scale every weight each tick, then draw (lazy O(1) scale)
+static void BM_ScaleWeightsAndSelect(benchmark::State& state) {
+    const int numElements = state.range(0);
+    RouletteWheel<int, double> wheel(indexedOptions());
+    for (int i = 0; i < numElements; ++i) {
+        wheel.addRegion(i, 1.0 + i % 13);
+    }
+
+    for (auto _ : state) {
+        wheel.scaleWeights(1.01);
+        benchmark::DoNotOptimize(wheel.select());
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_ScaleWeightsAndSelect)->Arg(10000)->Arg(1000000);
+
+// Benchmark: The same tick done eagerly, growing every region's weight by 1%
+static void BM_EagerScaleAndSelect(benchmark::State& state) {
+    const int numElements = state.range(0);
+    RouletteWheel<int, double> wheel(indexedOptions());
+    for (int i = 0; i < numElements; ++i) {
+        wheel.addRegion(i, 1.0 + i % 13);
+    }
+
+    for (auto _ : state) {
+        for (int i = 0; i < numElements; ++i) {
+            wheel.addRegion(i, wheel.getRegions()[i].getWeight() * 0.01);
+        }
+        benchmark::DoNotOptimize(wheel.select());
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_EagerScaleAndSelect)->Arg(10000)->Arg(1000000);
+
+// Benchmark: Draws under a fixed temperature (cumulative effective weights are cached)
+static void BM_TemperatureSelect(benchmark::State& state) {
+    const int numElements = state.range(0);
+    RouletteWheel<int, double> wheel(indexedOptions());
+    for (int i = 0; i < numElements; ++i) {
+        wheel.addRegion(i, 1.0 + i % 13);
+    }
+    wheel.setTemperature(0.5);
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(wheel.select());
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_TemperatureSelect)->Arg(10000)->Arg(1000000);
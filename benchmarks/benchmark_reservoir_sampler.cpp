@@ -0,0 +1,61 @@
+#include "../WeightedReservoirSampler.hpp"
+#include <benchmark/benchmark.h>
+#include <vector>
+
+using Sampler = WeightedReservoirSampler<int, double>;
+
+static constexpr int streamLength = 1000000;
+
+static const std::vector<double>& streamWeights() {
+    static const std::vector<double> weights = [] {
+        std::vector<double> values(streamLength);
+        for (int i = 0; i < streamLength; ++i) {
+            values[i] = 1.0 + (static_cast<long long>(i) * 7919) % 1000;
+        }
+        return values;
+    }();
+    return weights;
+}
+
+static void offerStream(benchmark::State& state, Sampler::Algorithm algorithm) {
+    const std::vector<double>& weights = streamWeights();
+    Sampler::Options options;
+    options.algorithm = algorithm;
+    for (auto _ : state) {
+        Sampler sampler(static_cast<size_t>(state.range(0)), options);
+        for (int i = 0; i < streamLength; ++i) {
+            sampler.offer(i, weights[i]);
+        }
+        benchmark::DoNotOptimize(sampler.size());
+    }
+    state.SetItemsProcessed(state.iterations() * streamLength);
+}
+
+static void BM_Reservoir_ReservoirKeys(benchmark::State& state) {
+    offerStream(state, Sampler::Algorithm::ReservoirKeys);
+}
+BENCHMARK(BM_Reservoir_ReservoirKeys)->Arg(10)->Arg(1000)->Arg(100000)->Unit(benchmark::kMillisecond);
+
+static void BM_Reservoir_ExponentialJumps(benchmark::State& state) {
+    offerStream(state, Sampler::Algorithm::ExponentialJumps);
+}
+BENCHMARK(BM_Reservoir_ExponentialJumps)->Arg(10)->Arg(1000)->Arg(100000)->Unit(benchmark::kMillisecond);
+
+// Combining per-shard reservoirs, as after a parallel pass over a sharded stream
+static void BM_Reservoir_MergeShards(benchmark::State& state) {
+    const std::vector<double>& weights = streamWeights();
+    const size_t capacity = static_cast<size_t>(state.range(0));
+    constexpr int shardCount = 8;
+    std::vector<Sampler> shards(shardCount, Sampler(capacity));
+    for (int i = 0; i < streamLength; ++i) {
+        shards[i % shardCount].offer(i, weights[i]);
+    }
+    for (auto _ : state) {
+        Sampler merged(capacity);
+        for (const Sampler& shard : shards) {
+            merged.merge(shard);
+        }
+        benchmark::DoNotOptimize(merged.size());
+    }
+}
+BENCHMARK(BM_Reservoir_MergeShards)->Arg(10)->Arg(1000)->Arg(100000);
@@ -1,7 +1,9 @@
 #include "../RouletteWheel.hpp"
 #include <benchmark/benchmark.h>
+#include <array>
 #include <string>
 #include <random>
+#include <vector>
 
 // Benchmark: Selection from small wheel (5 elements)
 static void BM_SelectionSmallWheel(benchmark::State& state) {
@@ -191,6 +193,106 @@ static void BM_SelectAndModifyWeight(benchmark::State& state) {
 }
 BENCHMARK(BM_SelectAndModifyWeight);
 
+// Benchmark: SelectAndModifyWeight under a pinned engine (0 = scan, 1 = stochastic acceptance,
+// 2 = Fenwick tree) on wheels whose weights stay within a factor of two of each other
+static void BM_SelectAndModifyWeightByStrategy(benchmark::State& state) {
+    const std::array<WheelStrategy, 3> strategies = {
+        WheelStrategy::LinearScan, WheelStrategy::StochasticAcceptance, WheelStrategy::FenwickTree
+    };
+    const RouletteWheel<int, int>::Options options{true, strategies[state.range(0)]};
+    const int numElements = state.range(1);
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        RouletteWheel<int, int> wheel(options);
+        for (int i = 0; i < numElements; ++i) {
+            wheel.addRegion(i, 100 + i % 100);
+        }
+        state.ResumeTiming();
+
+        for (int i = 0; i < 1000; ++i) {
+            benchmark::DoNotOptimize(wheel.selectAndModifyWeight(-1));
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() * 1000);
+}
+BENCHMARK(BM_SelectAndModifyWeightByStrategy)
+    ->Args({0, 100})->Args({1, 100})->Args({2, 100})
+    ->Args({0, 10000})->Args({1, 10000})->Args({2, 10000});
+
+// Masks disabling a percentage of a 10k-region wheel, spread evenly across it
+static std::vector<bool> makeSelectionMask(int numElements, int percentDisabled) {
+    std::vector<bool> enabled(numElements, true);
+    for (int i = 0; i < numElements; ++i) {
+        enabled[i] = (i * 37 % 100) >= percentDisabled;
+    }
+    return enabled;
+}
+
+// Benchmark: Masked selection. Arguments: (percent of regions disabled, number of regions)
+static void BM_MaskedSelection(benchmark::State& state) {
+    const int numElements = state.range(1);
+    RouletteWheel<int, int> wheel;
+    for (int i = 0; i < numElements; ++i) {
+        wheel.addRegion(i, i % 13 + 1);
+    }
+    const std::vector<bool> enabled = makeSelectionMask(numElements, state.range(0));
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(wheel.select(enabled));
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_MaskedSelection)->Args({1, 10000})->Args({50, 10000})->Args({99, 10000});
+
+// Benchmark: Excluding the same regions by index list instead of a mask
+static void BM_SelectExcluding(benchmark::State& state) {
+    const int numElements = state.range(1);
+    RouletteWheel<int, int> wheel;
+    for (int i = 0; i < numElements; ++i) {
+        wheel.addRegion(i, i % 13 + 1);
+    }
+    const std::vector<bool> enabled = makeSelectionMask(numElements, state.range(0));
+    std::vector<size_t> excluded;
+    for (int i = 0; i < numElements; ++i) {
+        if (!enabled[i]) {
+            excluded.push_back(i);
+        }
+    }
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(wheel.selectExcluding(excluded));
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_SelectExcluding)->Args({1, 10000})->Args({50, 10000})->Args({99, 10000});
+
+// Benchmark: The same draws done the old way, by copying the wheel and removing masked regions
+static void BM_MaskedSelectionByCopy(benchmark::State& state) {
+    const int numElements = state.range(1);
+    RouletteWheel<int, int> wheel;
+    for (int i = 0; i < numElements; ++i) {
+        wheel.addRegion(i, i % 13 + 1);
+    }
+    const std::vector<bool> enabled = makeSelectionMask(numElements, state.range(0));
+
+    for (auto _ : state) {
+        RouletteWheel<int, int> legal = wheel;
+        for (int i = numElements - 1; i >= 0; --i) {
+            if (!enabled[i]) {
+                legal.removeElement(i);
+            }
+        }
+        benchmark::DoNotOptimize(legal.select());
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_MaskedSelectionByCopy)->Args({1, 10000})->Args({50, 10000})->Args({99, 10000});
+
 // Benchmark: SelectSafe (with optional return)
 static void BM_SelectSafe(benchmark::State& state) {
     RouletteWheel<int, int> wheel;
@@ -0,0 +1,78 @@
+#ifdef USE_CEREAL
+
+#include "../RouletteWheel.hpp"
+#include <benchmark/benchmark.h>
+#include <cereal/archives/binary.hpp>
+#include <cereal/types/vector.hpp>
+#include <optional>
+#include <sstream>
+#include <string>
+
+using Wheel = RouletteWheel<int, double>;
+
+// Saves a large alias-table wheel, with or without its cache
+static std::string savedWheel(int size, bool withCaches) {
+    Wheel::Options options;
+    options.strategy = Wheel::Strategy::AliasTable;
+    options.serializeCaches = withCaches;
+    options.indexElements = true;
+    Wheel wheel(options);
+    wheel.reserve(size);
+    for (int i = 0; i < size; ++i) {
+        wheel.addRegion(i, 1.0 + (i % 97));
+    }
+    wheel.select();
+
+    std::ostringstream stream;
+    {
+        cereal::BinaryOutputArchive archive(stream);
+        archive(wheel);
+    }
+    return stream.str();
+}
+
+// Load followed by the first draw: without caches the draw pays for the alias table build
+static void BM_Serialization_LoadAndFirstDraw(benchmark::State& state) {
+    const bool withCaches = state.range(1) != 0;
+    const std::string bytes = savedWheel(static_cast<int>(state.range(0)), withCaches);
+    for (auto _ : state) {
+        std::istringstream stream(bytes);
+        Wheel::Options options;
+        options.strategy = Wheel::Strategy::AliasTable;
+        options.serializeCaches = withCaches;
+        Wheel wheel(options);
+        {
+            cereal::BinaryInputArchive archive(stream);
+            archive(wheel);
+        }
+        benchmark::DoNotOptimize(wheel.select());
+    }
+}
+BENCHMARK(BM_Serialization_LoadAndFirstDraw)
+    ->Args({1000, 0})->Args({1000, 1})
+    ->Args({100000, 0})->Args({100000, 1})
+    ->Args({1000000, 0})->Args({1000000, 1});
+
+// The first draw alone, after a load that had to rebuild nothing or everything
+static void BM_Serialization_FirstDrawAfterLoad(benchmark::State& state) {
+    const bool withCaches = state.range(1) != 0;
+    const std::string bytes = savedWheel(static_cast<int>(state.range(0)), withCaches);
+    std::optional<Wheel> wheel;
+    for (auto _ : state) {
+        state.PauseTiming();
+        std::istringstream stream(bytes);
+        Wheel::Options options;
+        options.strategy = Wheel::Strategy::AliasTable;
+        options.serializeCaches = withCaches;
+        wheel.emplace(options);
+        {
+            cereal::BinaryInputArchive archive(stream);
+            archive(*wheel);
+        }
+        state.ResumeTiming();
+        benchmark::DoNotOptimize(wheel->select());
+    }
+}
+BENCHMARK(BM_Serialization_FirstDrawAfterLoad)->Args({100000, 0})->Args({100000, 1})->Iterations(200);
+
+#endif
@@ -0,0 +1,58 @@
+#include "../SlidingWindowRouletteWheel.hpp"
+#include "../RouletteWheel.hpp"
+#include <benchmark/benchmark.h>
+
+static SlidingWindowRouletteWheel<int, double> filledWindow(size_t windowSize) {
+    SlidingWindowRouletteWheel<int, double> window(windowSize);
+    for (size_t i = 0; i < windowSize; ++i) {
+        window.addRegion(static_cast<int>(i), 1.0 + i % 100);
+    }
+    return window;
+}
+
+// Steady state: every add evicts the oldest region
+static void BM_SlidingWindow_AddEvict(benchmark::State& state) {
+    auto window = filledWindow(static_cast<size_t>(state.range(0)));
+    int next = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(window.addRegion(next, 1.0 + next % 100));
+        ++next;
+    }
+}
+BENCHMARK(BM_SlidingWindow_AddEvict)->Arg(10000)->Arg(1000000);
+
+static void BM_SlidingWindow_Select(benchmark::State& state) {
+    const auto window = filledWindow(static_cast<size_t>(state.range(0)));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(window.select());
+    }
+}
+BENCHMARK(BM_SlidingWindow_Select)->Arg(10000)->Arg(1000000);
+
+static void BM_SlidingWindow_AddEvictSelect(benchmark::State& state) {
+    auto window = filledWindow(static_cast<size_t>(state.range(0)));
+    int next = 0;
+    for (auto _ : state) {
+        window.addRegion(next, 1.0 + next % 100);
+        benchmark::DoNotOptimize(window.select());
+        ++next;
+    }
+}
+BENCHMARK(BM_SlidingWindow_AddEvictSelect)->Arg(10000)->Arg(1000000);
+
+// The idiom the window replaces: addRegion the newest element, removeElement the oldest
+static void BM_SlidingWindow_RouletteWheelAddRemove(benchmark::State& state) {
+    const int windowSize = static_cast<int>(state.range(0));
+    RouletteWheel<int, double> wheel;
+    for (int i = 0; i < windowSize; ++i) {
+        wheel.addRegion(i, 1.0 + i % 100);
+    }
+    int next = windowSize;
+    for (auto _ : state) {
+        wheel.removeElement(next - windowSize);
+        wheel.addRegion(next, 1.0 + next % 100);
+        benchmark::DoNotOptimize(wheel.select());
+        ++next;
+    }
+}
+BENCHMARK(BM_SlidingWindow_RouletteWheelAddRemove)->Arg(10000)->Arg(100000);
@@ -0,0 +1,103 @@
+#include "../RouletteWheel.hpp"
+#include "../StaticRouletteWheel.hpp"
+#include <benchmark/benchmark.h>
+
+// Benchmark: Building a small decision wheel inline
+template<size_t N>
+static void BM_StaticWheelConstruction(benchmark::State& state) {
+    for (auto _ : state) {
+        StaticRouletteWheel<int, int, N> wheel;
+        for (size_t i = 0; i < N; ++i) {
+            wheel.addRegion(static_cast<int>(i), static_cast<int>(i) + 1);
+        }
+        benchmark::DoNotOptimize(wheel);
+    }
+}
+BENCHMARK_TEMPLATE(BM_StaticWheelConstruction, 4);
+BENCHMARK_TEMPLATE(BM_StaticWheelConstruction, 8);
+BENCHMARK_TEMPLATE(BM_StaticWheelConstruction, 16);
+
+// Benchmark: Building the same wheel on the heap
+template<size_t N>
+static void BM_DynamicWheelConstruction(benchmark::State& state) {
+    for (auto _ : state) {
+        RouletteWheel<int, int> wheel;
+        for (size_t i = 0; i < N; ++i) {
+            wheel.addRegion(static_cast<int>(i), static_cast<int>(i) + 1);
+        }
+        benchmark::DoNotOptimize(wheel);
+    }
+}
+BENCHMARK_TEMPLATE(BM_DynamicWheelConstruction, 4);
+BENCHMARK_TEMPLATE(BM_DynamicWheelConstruction, 8);
+BENCHMARK_TEMPLATE(BM_DynamicWheelConstruction, 16);
+
+// Benchmark: Copying an inline wheel (a memcpy for trivially copyable E and W)
+template<size_t N>
+static void BM_StaticWheelCopy(benchmark::State& state) {
+    StaticRouletteWheel<int, int, N> original;
+    for (size_t i = 0; i < N; ++i) {
+        original.addRegion(static_cast<int>(i), static_cast<int>(i) + 1);
+    }
+
+    for (auto _ : state) {
+        StaticRouletteWheel<int, int, N> copy = original;
+        benchmark::DoNotOptimize(copy);
+    }
+}
+BENCHMARK_TEMPLATE(BM_StaticWheelCopy, 4);
+BENCHMARK_TEMPLATE(BM_StaticWheelCopy, 8);
+BENCHMARK_TEMPLATE(BM_StaticWheelCopy, 16);
+
+// Benchmark: Copying the same wheel on the heap
+template<size_t N>
+static void BM_DynamicWheelCopy(benchmark::State& state) {
+    RouletteWheel<int, int> original;
+    for (size_t i = 0; i < N; ++i) {
+        original.addRegion(static_cast<int>(i), static_cast<int>(i) + 1);
+    }
+
+    for (auto _ : state) {
+        RouletteWheel<int, int> copy = original;
+        benchmark::DoNotOptimize(copy);
+    }
+}
+BENCHMARK_TEMPLATE(BM_DynamicWheelCopy, 4);
+BENCHMARK_TEMPLATE(BM_DynamicWheelCopy, 8);
+BENCHMARK_TEMPLATE(BM_DynamicWheelCopy, 16);
+
+// Benchmark: Selection from an inline wheel
+template<size_t N>
+static void BM_StaticWheelSelect(benchmark::State& state) {
+    StaticRouletteWheel<int, int, N> wheel;
+    for (size_t i = 0; i < N; ++i) {
+        wheel.addRegion(static_cast<int>(i), static_cast<int>(i) + 1);
+    }
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(wheel.select());
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK_TEMPLATE(BM_StaticWheelSelect, 4);
+BENCHMARK_TEMPLATE(BM_StaticWheelSelect, 8);
+BENCHMARK_TEMPLATE(BM_StaticWheelSelect, 16);
+
+// Benchmark: Selection from the same wheel on the heap
+template<size_t N>
+static void BM_DynamicWheelSelect(benchmark::State& state) {
+    RouletteWheel<int, int> wheel;
+    for (size_t i = 0; i < N; ++i) {
+        wheel.addRegion(static_cast<int>(i), static_cast<int>(i) + 1);
+    }
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(wheel.select());
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK_TEMPLATE(BM_DynamicWheelSelect, 4);
+BENCHMARK_TEMPLATE(BM_DynamicWheelSelect, 8);
+BENCHMARK_TEMPLATE(BM_DynamicWheelSelect, 16);
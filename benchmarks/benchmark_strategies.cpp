@@ -0,0 +1,187 @@
+#include "../RouletteWheel.hpp"
+#include <benchmark/benchmark.h>
+#include <array>
+#include <cmath>
+#include <random>
+
+// Each benchmark runs one workload mix under Automatic and under every pinned engine.
+// Arguments: (strategy index into benchmarkStrategies, number of regions)
+static const std::array<WheelStrategy, 5> benchmarkStrategies = {
+    WheelStrategy::Automatic, WheelStrategy::LinearScan, WheelStrategy::PrefixSum,
+    WheelStrategy::AliasTable, WheelStrategy::FenwickTree
+};
+
+static const char* strategyName(WheelStrategy strategy) {
+    switch (strategy) {
+        case WheelStrategy::Automatic: return "Automatic";
+        case WheelStrategy::LinearScan: return "LinearScan";
+        case WheelStrategy::PrefixSum: return "PrefixSum";
+        case WheelStrategy::AliasTable: return "AliasTable";
+        case WheelStrategy::FenwickTree: return "FenwickTree";
+        case WheelStrategy::StochasticAcceptance: return "StochasticAcceptance";
+        case WheelStrategy::PowerOfTwoBuckets: return "PowerOfTwoBuckets";
+    }
+    return "";
+}
+
+// The wheels below are filled and updated through addRegion, which looks each element up
+// first, so they index their elements to keep the lookups out of the measurements
+template<typename W>
+static typename RouletteWheel<int, W>::Options indexedOptions(WheelStrategy strategy) {
+    typename RouletteWheel<int, W>::Options options;
+    options.strategy = strategy;
+    options.indexElements = true;
+    return options;
+}
+
+static RouletteWheel<int, int> makeStrategyWheel(const benchmark::State& state) {
+    const WheelStrategy strategy = benchmarkStrategies[state.range(0)];
+    RouletteWheel<int, int> wheel(indexedOptions<int>(strategy));
+    const int numElements = static_cast<int>(state.range(1));
+    wheel.reserve(numElements);
+    for (int i = 0; i < numElements; ++i) {
+        wheel.addRegion(i, i % 13 + 1);
+    }
+    return wheel;
+}
+
+static void strategyArguments(benchmark::internal::Benchmark* benchmark) {
+    for (const int64_t numElements : {100, 10000, 500000}) {
+        for (size_t strategy = 0; strategy < benchmarkStrategies.size(); ++strategy) {
+            // A linear scan per draw over 500k regions only confirms it is slow
+            if (numElements == 500000 && benchmarkStrategies[strategy] == WheelStrategy::LinearScan) {
+                continue;
+            }
+            benchmark->Args({static_cast<int64_t>(strategy), numElements});
+        }
+    }
+}
+
+// Benchmark: 99 draws for every weight change
+static void BM_WorkloadReadHeavy(benchmark::State& state) {
+    RouletteWheel<int, int> wheel = makeStrategyWheel(state);
+    const int numElements = static_cast<int>(state.range(1));
+    int step = 0;
+
+    for (auto _ : state) {
+        if (++step % 100 == 0) {
+            wheel.addRegion(step % numElements, 1);
+        } else {
+            benchmark::DoNotOptimize(wheel.select());
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations());
+    state.SetLabel(strategyName(wheel.getActiveStrategy()));
+}
+BENCHMARK(BM_WorkloadReadHeavy)->Apply(strategyArguments);
+
+// Benchmark: every draw changes the drawn region's weight, plus extra weight changes
+static void BM_WorkloadWriteHeavy(benchmark::State& state) {
+    RouletteWheel<int, int> wheel = makeStrategyWheel(state);
+    const int numElements = static_cast<int>(state.range(1));
+    int step = 0;
+
+    for (auto _ : state) {
+        if (++step % 4 == 0) {
+            benchmark::DoNotOptimize(wheel.selectAndModifyWeight(1));
+        } else {
+            wheel.addRegion((step * 7919) % numElements, 1);
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations());
+    state.SetLabel(strategyName(wheel.getActiveStrategy()));
+}
+BENCHMARK(BM_WorkloadWriteHeavy)->Apply(strategyArguments);
+
+// Benchmark: long read-only phases alternating with long write-heavy phases
+static void BM_WorkloadAlternating(benchmark::State& state) {
+    RouletteWheel<int, int> wheel = makeStrategyWheel(state);
+    const int phaseLength = 20000;
+    int step = 0;
+
+    for (auto _ : state) {
+        const bool readPhase = (step++ / phaseLength) % 2 == 0;
+        if (readPhase) {
+            benchmark::DoNotOptimize(wheel.select());
+        } else {
+            benchmark::DoNotOptimize(wheel.selectAndModifyWeight(1));
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations());
+    state.SetLabel(strategyName(wheel.getActiveStrategy()));
+}
+BENCHMARK(BM_WorkloadAlternating)->Apply(strategyArguments);
+
+// Benchmark: a crowd wheel whose weights change continuously over a wide dynamic range.
+// Arguments: (0 = Fenwick tree, 1 = power-of-two buckets, number of regions)
+static void BM_CrowdWheelUpdateAndSelect(benchmark::State& state) {
+    const WheelStrategy strategy = state.range(0) == 0 ? WheelStrategy::FenwickTree : WheelStrategy::PowerOfTwoBuckets;
+    RouletteWheel<int, double> wheel(indexedOptions<double>(strategy));
+    const int numElements = static_cast<int>(state.range(1));
+    wheel.reserve(numElements);
+    for (int i = 0; i < numElements; ++i) {
+        wheel.addRegion(i, std::ldexp(1.0 + (i % 97) / 97.0, i % 40 - 20));  // 2^-20 .. 2^20
+    }
+    std::mt19937 rng(7);
+    std::uniform_int_distribution<int> pickRegion(0, numElements - 1);
+
+    for (auto _ : state) {
+        // Grow a random region by 1% (slowly moving it across scales), then draw
+        const int region = pickRegion(rng);
+        wheel.addRegion(region, wheel.getRegions()[region].getWeight() * 0.01);
+        benchmark::DoNotOptimize(wheel.select());
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_CrowdWheelUpdateAndSelect)
+    ->Args({0, 10000})->Args({1, 10000})
+    ->Args({0, 1000000})->Args({1, 1000000});
+
+// Benchmark: the same crowd wheel where every draw bumps the drawn region (no element lookup)
+// Arguments: (0 = Fenwick tree, 1 = power-of-two buckets, number of regions)
+static void BM_CrowdWheelSelectAndModify(benchmark::State& state) {
+    const WheelStrategy strategy = state.range(0) == 0 ? WheelStrategy::FenwickTree : WheelStrategy::PowerOfTwoBuckets;
+    RouletteWheel<int, double> wheel(indexedOptions<double>(strategy));
+    const int numElements = static_cast<int>(state.range(1));
+    wheel.reserve(numElements);
+    for (int i = 0; i < numElements; ++i) {
+        wheel.addRegion(i, std::ldexp(1.0 + (i % 97) / 97.0, i % 40 - 20));  // 2^-20 .. 2^20
+    }
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(wheel.selectAndModifyWeight(0.5));
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_CrowdWheelSelectAndModify)
+    ->Args({0, 10000})->Args({1, 10000})
+    ->Args({0, 1000000})->Args({1, 1000000});
+
+// Benchmark: the crowd wheel losing a random region and gaining a new one every step
+// Arguments: (0 = Fenwick tree, 1 = power-of-two buckets, number of regions)
+static void BM_CrowdWheelChurn(benchmark::State& state) {
+    const WheelStrategy strategy = state.range(0) == 0 ? WheelStrategy::FenwickTree : WheelStrategy::PowerOfTwoBuckets;
+    RouletteWheel<int, double> wheel(indexedOptions<double>(strategy));
+    const int numElements = static_cast<int>(state.range(1));
+    wheel.reserve(numElements);
+    for (int i = 0; i < numElements; ++i) {
+        wheel.addRegion(i, std::ldexp(1.0 + (i % 97) / 97.0, i % 40 - 20));  // 2^-20 .. 2^20
+    }
+
+    int next = numElements;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(wheel.selectAndRemove());
+        wheel.addRegion(next, std::ldexp(1.0 + (next % 97) / 97.0, next % 40 - 20));
+        ++next;
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_CrowdWheelChurn)
+    ->Args({0, 10000})->Args({1, 10000})
+    ->Args({0, 1000000})->Args({1, 1000000});
@@ -0,0 +1,57 @@
+#include "../WheelPool.hpp"
+#include "../RouletteWheel.hpp"
+#include <benchmark/benchmark.h>
+#include <tuple>
+#include <vector>
+
+enum class Action { Attack, Defend, Heal, Flee, Wander, Idle, Special, Taunt };
+
+// Each NPC gets 3 to 8 actions with varying weights
+static std::vector<std::tuple<Action, int>> npcActions(int npc) {
+    std::vector<std::tuple<Action, int>> actions;
+    const int actionCount = 3 + npc % 6;
+    for (int action = 0; action < actionCount; ++action) {
+        actions.emplace_back(static_cast<Action>(action), 1 + (npc * 7 + action * 13) % 50);
+    }
+    return actions;
+}
+
+// Benchmark: One draw for every NPC from a pool of small wheels
+static void BM_WheelPoolSelectAll(benchmark::State& state) {
+    const int numNpcs = state.range(0);
+    WheelPool<Action, int> pool;
+    pool.reserve(numNpcs, numNpcs * 6);
+    for (int npc = 0; npc < numNpcs; ++npc) {
+        pool.addWheel(npcActions(npc));
+    }
+    std::vector<Action> decisions(numNpcs);
+
+    for (auto _ : state) {
+        pool.selectAll(decisions.begin());
+        benchmark::DoNotOptimize(decisions.data());
+    }
+
+    state.SetItemsProcessed(state.iterations() * numNpcs);
+}
+BENCHMARK(BM_WheelPoolSelectAll)->Arg(200000)->Unit(benchmark::kMillisecond);
+
+// Benchmark: The same tick with one RouletteWheel per NPC
+static void BM_WheelVectorSelectAll(benchmark::State& state) {
+    const int numNpcs = state.range(0);
+    std::vector<RouletteWheel<Action, int>> wheels;
+    wheels.reserve(numNpcs);
+    for (int npc = 0; npc < numNpcs; ++npc) {
+        wheels.emplace_back(npcActions(npc));
+    }
+    std::vector<Action> decisions(numNpcs);
+
+    for (auto _ : state) {
+        for (int npc = 0; npc < numNpcs; ++npc) {
+            decisions[npc] = wheels[npc].select();
+        }
+        benchmark::DoNotOptimize(decisions.data());
+    }
+
+    state.SetItemsProcessed(state.iterations() * numNpcs);
+}
+BENCHMARK(BM_WheelVectorSelectAll)->Arg(200000)->Unit(benchmark::kMillisecond);
@@ -0,0 +1,162 @@
+#pragma once
+
+#include "WheelRandom.hpp"
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+#ifdef USE_CEREAL
+    #include <cereal/access.hpp>
+#endif
+
+/**
+ * @brief A Vose alias table for O(1) weighted selection.
+ *
+ * Building the table is O(n); each draw afterwards is a single random number and one
+ * table lookup, independent of the number of regions. Any weight change requires a rebuild,
+ * so this is the engine for wheels that are read far more often than they are modified.
+ *
+ * @tparam Allocator Allocator for the table (rebound to double and std::uint32_t)
+ */
+template<typename Allocator = std::allocator<double>>
+class AliasTable {
+public:
+    /**
+     * @brief Creates an empty table
+     * @param allocator Allocator for the table storage
+     */
+    explicit AliasTable(const Allocator& allocator = Allocator())
+        : probabilities(allocator)
+        , aliases(allocator) {
+    }
+
+    /**
+     * @brief Rebuilds the table in O(n)
+     * @param count Number of weights
+     * @param weightAt Callable returning the weight at a 0-based index (as a double)
+     * @param totalWeight Sum of all weights
+     */
+    template<typename WeightAt>
+    void build(size_t count, WeightAt weightAt, double totalWeight) {
+        probabilities.resize(count);
+        aliases.resize(count);
+
+        IndexVector small(aliases.get_allocator());
+        IndexVector large(aliases.get_allocator());
+        small.reserve(count);
+        large.reserve(count);
+
+        const double scale = static_cast<double>(count) / totalWeight;
+        for (size_t i = 0; i < count; ++i) {
+            probabilities[i] = static_cast<double>(weightAt(i)) * scale;
+            aliases[i] = static_cast<std::uint32_t>(i);
+            if (probabilities[i] < 1.0) {
+                small.push_back(static_cast<std::uint32_t>(i));
+            } else {
+                large.push_back(static_cast<std::uint32_t>(i));
+            }
+        }
+
+        while (!small.empty() && !large.empty()) {
+            const std::uint32_t under = small.back();
+            small.pop_back();
+            const std::uint32_t over = large.back();
+            large.pop_back();
+
+            aliases[under] = over;
+            probabilities[over] -= 1.0 - probabilities[under];
+            if (probabilities[over] < 1.0) {
+                small.push_back(over);
+            } else {
+                large.push_back(over);
+            }
+        }
+
+        // Whatever remains is full up to rounding error
+        for (const std::uint32_t index : large) {
+            probabilities[index] = 1.0;
+        }
+        for (const std::uint32_t index : small) {
+            probabilities[index] = 1.0;
+        }
+    }
+
+    /**
+     * @brief Draws an index from the table
+     * @return Selected 0-based index
+     */
+    size_t sample() const {
+        return sample(probabilities.data(), aliases.data(), probabilities.size());
+    }
+
+    /**
+     * @brief Draws an index from raw alias table arrays (e.g. a table stored in a file)
+     * @param probabilities Per-column probability of keeping the column's own index
+     * @param aliases Per-column alias index
+     * @param count Number of columns (must be positive)
+     * @return Selected 0-based index
+     */
+    static size_t sample(const double* probabilities, const std::uint32_t* aliases, size_t count) {
+        // A single draw over [0, count) picks both the column and the offset within it
+        const double draw = WheelRandom::weightBelow(static_cast<double>(count));
+        const size_t column = std::min(static_cast<size_t>(draw), count - 1);
+        const double offset = draw - static_cast<double>(column);
+        return offset < probabilities[column] ? column : aliases[column];
+    }
+
+    /**
+     * @brief Gets the number of columns in the table
+     * @return Number of columns
+     */
+    size_t size() const {
+        return probabilities.size();
+    }
+
+    /**
+     * @brief Gets the per-column keep probabilities (e.g. to write the table to a file)
+     * @return Pointer to size() probabilities
+     */
+    const double* probabilityData() const {
+        return probabilities.data();
+    }
+
+    /**
+     * @brief Gets the per-column alias indices
+     * @return Pointer to size() alias indices
+     */
+    const std::uint32_t* aliasData() const {
+        return aliases.data();
+    }
+
+    /**
+     * @brief Empties the table
+     */
+    void clear() {
+        probabilities.clear();
+        aliases.clear();
+    }
+
+private:
+    using ProbabilityVector = std::vector<double,
+        typename std::allocator_traits<Allocator>::template rebind_alloc<double>>;
+    using IndexVector = std::vector<std::uint32_t,
+        typename std::allocator_traits<Allocator>::template rebind_alloc<std::uint32_t>>;
+
+    ProbabilityVector probabilities;
+    IndexVector aliases;
+
+#ifdef USE_CEREAL
+    friend class cereal::access;
+
+    /**
+     * @brief Serialization function for the cereal library (lets wheels persist the built table)
+     *
+     * @see https://github.com/USCiLab/cereal
+     */
+    template <class Archive>
+    void serialize(Archive& archive) {
+        archive(probabilities, aliases);
+    }
+#endif
+};
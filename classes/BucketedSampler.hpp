@@ -0,0 +1,288 @@
+#pragma once
+
+#include "WheelRandom.hpp"
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+/**
+ * @brief A dynamic weighted sampler that groups regions into power-of-two weight buckets.
+ *
+ * Region i lives in the bucket for floor(log2(weight_i)), so every weight in a bucket is
+ * within a factor of two of the bucket's upper bound. A draw picks a bucket in proportion to
+ * its total weight, then a region inside it by rejection (each attempt succeeds with
+ * probability at least 1/2), so a draw costs O(number of distinct weight scales present),
+ * independent of the number of regions (Matias, Vitter and Ni). Buckets are found through a
+ * table indexed by exponent, so appending, updating and swap-removing a weight cost O(1).
+ *
+ * @tparam W Weight type (must be numeric: int, float, double, etc.)
+ * @tparam Allocator Allocator for the bucket and index storage (rebound as needed)
+ */
+template<typename W, typename Allocator = std::allocator<W>>
+class BucketedSampler {
+public:
+    /**
+     * @brief Creates an empty sampler
+     * @param allocator Allocator for the bucket and index storage
+     */
+    explicit BucketedSampler(const Allocator& allocator = Allocator())
+        : buckets(BucketAllocator(allocator))
+        , bucketOfExponent(ExponentAllocator(allocator))
+        , exponentOfIndex(ExponentAllocator(allocator))
+        , slotInBucket(IndexAllocator(allocator))
+        , allocator(allocator) {
+    }
+
+    /**
+     * @brief Rebuilds the sampler from scratch in O(n)
+     * @param count Number of weights
+     * @param weightAt Callable returning the weight at a 0-based index
+     */
+    template<typename WeightAt>
+    void build(size_t count, WeightAt weightAt) {
+        clear();
+        exponentOfIndex.reserve(count);
+        slotInBucket.reserve(count);
+        for (size_t i = 0; i < count; ++i) {
+            pushBack(weightAt(i));
+        }
+    }
+
+    /**
+     * @brief Appends a weight
+     * @param weight The weight to append (must be positive)
+     */
+    void pushBack(W weight) {
+        const auto index = static_cast<std::uint32_t>(exponentOfIndex.size());
+        exponentOfIndex.push_back(0);
+        slotInBucket.push_back(0);
+        insertIntoBucket(index, weight);
+    }
+
+    /**
+     * @brief Changes the weight at an index, moving it between buckets if its scale changed
+     * @param index 0-based index
+     * @param oldWeight The current weight
+     * @param newWeight The new weight (must be positive)
+     */
+    void update(size_t index, W oldWeight, W newWeight) {
+        if (exponentOf(newWeight) == exponentOfIndex[index]) {
+            Bucket& bucket = buckets[findBucket(exponentOfIndex[index])];
+            bucket.total += newWeight - oldWeight;
+            total += newWeight - oldWeight;
+            return;
+        }
+        removeFromBucket(index, oldWeight);
+        insertIntoBucket(static_cast<std::uint32_t>(index), newWeight);
+    }
+
+    /**
+     * @brief Removes the weight at an index by moving the last index into its place, so
+     *        the caller must move its own last entry the same way
+     * @param index 0-based index
+     * @param weight The weight at index
+     */
+    void swapRemove(size_t index, W weight) {
+        removeFromBucket(index, weight);
+        const size_t last = exponentOfIndex.size() - 1;
+        if (index != last) {
+            const std::uint32_t slot = slotInBucket[last];
+            buckets[findBucket(exponentOfIndex[last])].members[slot] = static_cast<std::uint32_t>(index);
+            exponentOfIndex[index] = exponentOfIndex[last];
+            slotInBucket[index] = slot;
+        }
+        exponentOfIndex.pop_back();
+        slotInBucket.pop_back();
+    }
+
+    /**
+     * @brief Recomputes the bucket totals from the current weights in O(n), discarding any
+     *        rounding error that floating-point updates accumulated
+     * @param weightAt Callable returning the current weight at a 0-based index
+     */
+    template<typename WeightAt>
+    void refreshTotals(WeightAt weightAt) {
+        total = W{0};
+        for (Bucket& bucket : buckets) {
+            bucket.total = W{0};
+            for (const std::uint32_t member : bucket.members) {
+                bucket.total += weightAt(member);
+            }
+            total += bucket.total;
+        }
+    }
+
+    /**
+     * @brief Draws an index in proportion to its weight
+     * @param weightAt Callable returning the current weight at a 0-based index
+     * @return Selected 0-based index
+     */
+    template<typename WeightAt>
+    size_t sample(WeightAt weightAt) const {
+        const Bucket* chosen = nullptr;
+        const W randomValue = WheelRandom::weightBelow(total);
+        W accumulatedWeight = W{0};
+        for (const Bucket& bucket : buckets) {
+            chosen = &bucket;
+            accumulatedWeight += bucket.total;
+            if (accumulatedWeight > randomValue) {
+                break;
+            }
+        }
+
+        // Every member weighs at least half the bucket's bound, so this loop expects <= 2 tries
+        for (;;) {
+            const std::uint32_t candidate = chosen->members[WheelRandom::indexBelow(chosen->members.size())];
+            if (WheelRandom::weightBelow(chosen->upperBound) < weightAt(candidate)) {
+                return candidate;
+            }
+        }
+    }
+
+    /**
+     * @brief Gets the sum of all weights
+     * @return Total weight
+     */
+    W getTotal() const {
+        return total;
+    }
+
+    /**
+     * @brief Gets the number of weights in the sampler
+     * @return Number of weights
+     */
+    size_t size() const {
+        return exponentOfIndex.size();
+    }
+
+    /**
+     * @brief Removes all weights (capacity is kept for the next build)
+     */
+    void clear() {
+        buckets.clear();
+        bucketOfExponent.clear();
+        exponentOfIndex.clear();
+        slotInBucket.clear();
+        total = W{0};
+    }
+
+private:
+    using IndexAllocator = typename std::allocator_traits<Allocator>::template rebind_alloc<std::uint32_t>;
+    using IndexVector = std::vector<std::uint32_t, IndexAllocator>;
+
+    /**
+     * @brief All regions whose weight lies in [2^exponent, 2^(exponent + 1))
+     */
+    struct Bucket {
+        int exponent;
+        W upperBound;
+        W total;
+        IndexVector members;
+    };
+
+    using BucketAllocator = typename std::allocator_traits<Allocator>::template rebind_alloc<Bucket>;
+    using ExponentAllocator = typename std::allocator_traits<Allocator>::template rebind_alloc<std::int16_t>;
+
+    /// Smallest exponent a positive weight can have (that of the smallest subnormal for floats)
+    static constexpr int minimumExponent = std::is_integral_v<W>
+        ? 0 : std::numeric_limits<W>::min_exponent - std::numeric_limits<W>::digits;
+
+    /// Number of possible exponents, and so the size of bucketOfExponent
+    static constexpr int exponentCount = (std::is_integral_v<W>
+        ? std::numeric_limits<W>::digits : std::numeric_limits<W>::max_exponent) - minimumExponent;
+
+    std::vector<Bucket, BucketAllocator> buckets; ///< Non-empty buckets only, in no particular order
+    std::vector<std::int16_t, ExponentAllocator> bucketOfExponent; ///< Position in buckets per exponent, or -1 (filled on first use)
+    std::vector<std::int16_t, ExponentAllocator> exponentOfIndex; ///< Bucket exponent of each index
+    IndexVector slotInBucket; ///< Position of each index inside its bucket's members
+    Allocator allocator;
+    W total = W{0};
+
+    /**
+     * @brief Computes floor(log2(weight))
+     * @param weight A positive weight
+     * @return The weight's binary exponent
+     */
+    static int exponentOf(W weight) {
+        if constexpr (std::is_integral_v<W>) {
+            int exponent = 0;
+            for (auto value = static_cast<unsigned long long>(weight); value > 1; value >>= 1) {
+                ++exponent;
+            }
+            return exponent;
+        } else {
+            return std::ilogb(weight);
+        }
+    }
+
+    /**
+     * @brief Computes the exclusive upper bound of a bucket's weights
+     * @param exponent The bucket's exponent
+     * @return 2^(exponent + 1), clamped to the largest representable weight
+     */
+    static W upperBoundOf(int exponent) {
+        if constexpr (std::is_integral_v<W>) {
+            if (exponent + 1 >= std::numeric_limits<W>::digits) {
+                return std::numeric_limits<W>::max();
+            }
+            return static_cast<W>(W{1} << (exponent + 1));
+        } else {
+            return static_cast<W>(std::ldexp(1.0, exponent + 1));
+        }
+    }
+
+    /**
+     * @brief Finds the bucket for an exponent
+     * @param exponent The exponent (its bucket must exist)
+     * @return Position of the bucket in buckets
+     */
+    size_t findBucket(int exponent) const {
+        return static_cast<size_t>(bucketOfExponent[exponent - minimumExponent]);
+    }
+
+    void insertIntoBucket(std::uint32_t index, W weight) {
+        const int exponent = exponentOf(weight);
+        if (bucketOfExponent.empty()) {
+            bucketOfExponent.assign(exponentCount, std::int16_t{-1});
+        }
+        std::int16_t& slot = bucketOfExponent[exponent - minimumExponent];
+        if (slot < 0) {
+            slot = static_cast<std::int16_t>(buckets.size());
+            buckets.push_back(Bucket{exponent, upperBoundOf(exponent), W{0}, IndexVector(IndexAllocator(allocator))});
+        }
+        const size_t position = static_cast<size_t>(slot);
+
+        Bucket& bucket = buckets[position];
+        exponentOfIndex[index] = static_cast<std::int16_t>(exponent);
+        slotInBucket[index] = static_cast<std::uint32_t>(bucket.members.size());
+        bucket.members.push_back(index);
+        bucket.total += weight;
+        total += weight;
+    }
+
+    void removeFromBucket(size_t index, W weight) {
+        const size_t position = findBucket(exponentOfIndex[index]);
+        Bucket& bucket = buckets[position];
+        const std::uint32_t slot = slotInBucket[index];
+        const std::uint32_t moved = bucket.members.back();
+        bucket.members[slot] = moved;
+        slotInBucket[moved] = slot;
+        bucket.members.pop_back();
+        bucket.total -= weight;
+        total -= weight;
+
+        // Regions only remember their exponent, so an emptied bucket can simply be dropped
+        if (bucket.members.empty()) {
+            bucketOfExponent[bucket.exponent - minimumExponent] = -1;
+            if (position + 1 != buckets.size()) {
+                buckets[position] = std::move(buckets.back());
+                bucketOfExponent[buckets[position].exponent - minimumExponent] = static_cast<std::int16_t>(position);
+            }
+            buckets.pop_back();
+        }
+    }
+};
@@ -0,0 +1,259 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/**
+ * @brief Detects whether std::hash is enabled for a type
+ */
+template<typename T, typename = void>
+struct IsHashable : std::false_type {};
+
+template<typename T>
+struct IsHashable<T, std::void_t<decltype(std::hash<T>{}(std::declval<const T&>()))>> : std::true_type {};
+
+/**
+ * @brief Maps elements to their region index so element lookups are O(1) on large wheels.
+ *
+ * The index never holds an element: each entry is the element's hash and the index of its
+ * region, and a candidate is confirmed by comparing against the regions passed to find.
+ * Entries live in one open-addressing table, so indexing a wheel of strings allocates a single
+ * array no matter how long the strings are.
+ *
+ * Small wheels (and element types without std::hash) are scanned linearly, which is
+ * faster than hashing for a handful of regions. Once a wheel reaches minimumIndexedSize
+ * regions the index is built on the next lookup and kept up to date on appends. Erasing
+ * from the middle of a wheel shifts every later index, so instead of rewriting the suffix
+ * the index is marked stale and rebuilt lazily by the next lookup; drain loops that never
+ * look elements up pay nothing.
+ *
+ * @tparam E Element type
+ * @tparam Allocator Allocator for the table (rebound to its entry type)
+ */
+template<typename E, typename Allocator = std::allocator<E>>
+class ElementIndex {
+public:
+    /// Wheels smaller than this are scanned instead of hashed
+    static constexpr size_t minimumIndexedSize = 64;
+
+    /// Whether E can be hashed at all
+    static constexpr bool hashable = IsHashable<E>::value;
+
+    /**
+     * @brief Creates an empty (stale) index
+     * @param allocator Allocator for the table
+     */
+    explicit ElementIndex(const Allocator& allocator = Allocator())
+        : slots(SlotAllocator(allocator)) {
+    }
+
+    /**
+     * @brief Finds the index of an element among the first searchEnd regions
+     * @param element The element to find
+     * @param regions The wheel's regions
+     * @param searchEnd Only regions before this index are searched
+     * @return Optional containing the lowest matching index, or nullopt if not found
+     */
+    template<typename Regions>
+    std::optional<size_t> find(const E& element, const Regions& regions, size_t searchEnd) const {
+        const size_t end = std::min(searchEnd, regions.size());
+        if constexpr (hashable) {
+            if (end >= minimumIndexedSize) {
+                if (stale) {
+                    rebuild(regions);
+                }
+                const size_t hash = hashOf(element);
+                std::optional<size_t> found;
+                for (size_t slot = hash & mask(); slots[slot].index != emptySlot; slot = (slot + 1) & mask()) {
+                    const Slot& entry = slots[slot];
+                    if (entry.hash == hash && entry.index < end && (!found.has_value() || entry.index < *found)
+                        && regions[entry.index].getElement() == element) {
+                        found = entry.index;
+                    }
+                }
+                return found;
+            }
+        }
+
+        for (size_t i = 0; i < end; ++i) {
+            if (regions[i].getElement() == element) {
+                return i;
+            }
+        }
+        return std::nullopt;
+    }
+
+    /**
+     * @brief Records a region appended at the end of the wheel
+     * @param element The new region's element
+     * @param index The new region's index
+     */
+    void onAppend(const E& element, size_t index) {
+        if constexpr (hashable) {
+            if (!stale) {
+                if ((count + 1) * 2 > slots.size()) {
+                    resizeTable(slots.size() * 2);
+                }
+                insert(Slot{hashOf(element), index});
+            }
+        }
+    }
+
+    /**
+     * @brief Records a region erased from the wheel
+     * @param element The erased region's element (still intact)
+     * @param index The erased region's index
+     * @param previousSize Number of regions before the erase
+     */
+    void onErase(const E& element, size_t index, size_t previousSize) {
+        if constexpr (hashable) {
+            if (!stale && index + 1 == previousSize) {
+                removeEntry(hashOf(element), index);
+                return;
+            }
+        }
+        invalidate();
+    }
+
+    /**
+     * @brief Records a swap-erase: the region at index was erased and the region at
+     *        movedFrom (the last one) was moved into its place
+     * @param erased The erased region's element (still intact)
+     * @param moved The element that now lives at index
+     * @param index The erased region's index
+     * @param movedFrom The moved region's previous index
+     */
+    void onSwapErase(const E& erased, const E& moved, size_t index, size_t movedFrom) {
+        if constexpr (hashable) {
+            if (!stale) {
+                removeEntry(hashOf(erased), index);
+                if (Slot* entry = findEntry(hashOf(moved), movedFrom)) {
+                    entry->index = index;
+                }
+            }
+        }
+    }
+
+    /**
+     * @brief Makes room for the given number of elements so filling a large wheel never rehashes
+     * @param capacity Expected number of regions
+     */
+    void reserve(size_t capacity) {
+        if constexpr (hashable) {
+            if (capacity >= minimumIndexedSize && tableSizeFor(capacity) > slots.size()) {
+                resizeTable(tableSizeFor(capacity));
+            }
+        }
+    }
+
+    /**
+     * @brief Marks the index as out of date (e.g. after regions were reordered or removed)
+     */
+    void invalidate() {
+        stale = true;
+    }
+
+private:
+    struct Slot {
+        size_t hash;
+        size_t index;
+    };
+
+    using SlotAllocator = typename std::allocator_traits<Allocator>::template rebind_alloc<Slot>;
+
+    static constexpr size_t emptySlot = SIZE_MAX;
+
+    mutable std::vector<Slot, SlotAllocator> slots; ///< Power-of-two table, at most half full
+    mutable size_t count = 0;   ///< Occupied slots
+    mutable bool stale = true;  ///< While false, slots is current
+
+    /// std::hash is often the identity (for integers), which would pack consecutive keys into
+    /// one long probe run, so its result is scrambled (the splitmix64 finalizer) first
+    static size_t hashOf(const E& element) {
+        uint64_t hash = static_cast<uint64_t>(std::hash<E>{}(element));
+        hash = (hash ^ (hash >> 30)) * 0xBF58476D1CE4E5B9ull;
+        hash = (hash ^ (hash >> 27)) * 0x94D049BB133111EBull;
+        return static_cast<size_t>(hash ^ (hash >> 31));
+    }
+
+    static size_t tableSizeFor(size_t elements) {
+        size_t size = minimumIndexedSize * 2;
+        while (size < elements * 2) {
+            size *= 2;
+        }
+        return size;
+    }
+
+    size_t mask() const {
+        return slots.size() - 1;
+    }
+
+    void insert(const Slot& entry) const {
+        size_t slot = entry.hash & mask();
+        while (slots[slot].index != emptySlot) {
+            slot = (slot + 1) & mask();
+        }
+        slots[slot] = entry;
+        ++count;
+    }
+
+    Slot* findEntry(size_t hash, size_t index) {
+        if (slots.empty()) {
+            return nullptr;
+        }
+        for (size_t slot = hash & mask(); slots[slot].index != emptySlot; slot = (slot + 1) & mask()) {
+            if (slots[slot].index == index) {
+                return &slots[slot];
+            }
+        }
+        return nullptr;
+    }
+
+    void removeEntry(size_t hash, size_t index) {
+        Slot* entry = findEntry(hash, index);
+        if (entry == nullptr) {
+            return;
+        }
+
+        // Backward-shift deletion: pull later entries of the probe run into the hole
+        size_t hole = static_cast<size_t>(entry - slots.data());
+        for (size_t next = (hole + 1) & mask(); slots[next].index != emptySlot; next = (next + 1) & mask()) {
+            const size_t home = slots[next].hash & mask();
+            if (((next - home) & mask()) >= ((next - hole) & mask())) {
+                slots[hole] = slots[next];
+                hole = next;
+            }
+        }
+        slots[hole].index = emptySlot;
+        --count;
+    }
+
+    void resizeTable(size_t size) const {
+        std::vector<Slot, SlotAllocator> previous(size, Slot{0, emptySlot}, slots.get_allocator());
+        previous.swap(slots);
+        count = 0;
+        for (const Slot& entry : previous) {
+            if (entry.index != emptySlot) {
+                insert(entry);
+            }
+        }
+    }
+
+    template<typename Regions>
+    void rebuild(const Regions& regions) const {
+        const size_t size = std::max(tableSizeFor(regions.size()), slots.size());
+        slots.assign(size, Slot{0, emptySlot});
+        count = 0;
+        for (size_t i = 0; i < regions.size(); ++i) {
+            insert(Slot{hashOf(regions[i].getElement()), i});
+        }
+        stale = false;
+    }
+};
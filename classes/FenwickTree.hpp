@@ -0,0 +1,172 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <vector>
+#ifdef USE_CEREAL
+    #include <cereal/access.hpp>
+#endif
+
+/**
+ * @brief A Fenwick (binary indexed) tree over region weights.
+ *
+ * Supports O(log n) weight updates, O(log n) appends and O(log n) weighted selection,
+ * which makes it the dynamic-storage engine for wheels whose weights change between draws.
+ *
+ * @tparam W Weight type (must be numeric: int, float, double, etc.)
+ * @tparam Allocator Allocator for the tree nodes
+ */
+template<typename W, typename Allocator = std::allocator<W>>
+class FenwickTree {
+public:
+    /**
+     * @brief Creates an empty tree
+     * @param allocator Allocator for the tree nodes
+     */
+    explicit FenwickTree(const Allocator& allocator = Allocator())
+        : tree(allocator) {
+    }
+
+    /**
+     * @brief Rebuilds the tree from scratch in O(n)
+     * @param count Number of weights
+     * @param weightAt Callable returning the weight at a 0-based index
+     */
+    template<typename WeightAt>
+    void build(size_t count, WeightAt weightAt) {
+        tree.assign(count + 1, W{0});
+        total = W{0};
+        for (size_t node = 1; node <= count; ++node) {
+            const W weight = weightAt(node - 1);
+            tree[node] += weight;
+            total += weight;
+            const size_t parent = node + lowestBit(node);
+            if (parent <= count) {
+                tree[parent] += tree[node];
+            }
+        }
+    }
+
+    /**
+     * @brief Adds a delta to the weight at an index in O(log n)
+     * @param index 0-based index
+     * @param delta Amount to add (can be negative)
+     */
+    void add(size_t index, W delta) {
+        total += delta;
+        for (size_t node = index + 1; node < tree.size(); node += lowestBit(node)) {
+            tree[node] += delta;
+        }
+    }
+
+    /**
+     * @brief Appends a weight in O(log n)
+     * @param weight The weight to append
+     */
+    void pushBack(W weight) {
+        if (tree.empty()) {
+            tree.push_back(W{0});
+        }
+        const size_t node = tree.size();
+        W value = weight;
+        for (size_t child = node - 1; child > node - lowestBit(node); child -= lowestBit(child)) {
+            value += tree[child];
+        }
+        tree.push_back(value);
+        total += weight;
+    }
+
+    /**
+     * @brief Removes the last weight in O(1) (no other node covers the last position)
+     * @param lastWeight The weight currently stored at the last index
+     */
+    void popBack(W lastWeight) {
+        tree.pop_back();
+        total -= lastWeight;
+    }
+
+    /**
+     * @brief Finds the index whose cumulative weight range contains a target
+     * @param target A value in [0, getTotal())
+     * @return The first index i with prefixSum(i + 1) > target (clamped to the last index)
+     */
+    size_t find(W target) const {
+        size_t position = 0;
+        for (size_t step = highestPowerOfTwo(size()); step > 0; step >>= 1) {
+            const size_t next = position + step;
+            if (next < tree.size() && tree[next] <= target) {
+                position = next;
+                target -= tree[next];
+            }
+        }
+        return std::min(position, size() - 1);
+    }
+
+    /**
+     * @brief Sums the first count weights in O(log n)
+     * @param count Number of leading weights to sum
+     * @return The prefix sum
+     */
+    W prefixSum(size_t count) const {
+        W sum = W{0};
+        for (size_t node = count; node > 0; node -= lowestBit(node)) {
+            sum += tree[node];
+        }
+        return sum;
+    }
+
+    /**
+     * @brief Gets the sum of all weights
+     * @return Total weight
+     */
+    W getTotal() const {
+        return total;
+    }
+
+    /**
+     * @brief Gets the number of weights in the tree
+     * @return Number of weights
+     */
+    size_t size() const {
+        return tree.empty() ? 0 : tree.size() - 1;
+    }
+
+    /**
+     * @brief Removes all weights and releases nothing (capacity is kept for the next build)
+     */
+    void clear() {
+        tree.clear();
+        total = W{0};
+    }
+
+private:
+    std::vector<W, Allocator> tree; ///< 1-based nodes; tree[0] is unused
+    W total = W{0};
+
+    static size_t lowestBit(size_t value) {
+        return value & (~value + 1);
+    }
+
+    static size_t highestPowerOfTwo(size_t value) {
+        size_t power = 1;
+        while (power <= value / 2) {
+            power <<= 1;
+        }
+        return value == 0 ? 0 : power;
+    }
+
+#ifdef USE_CEREAL
+    friend class cereal::access;
+
+    /**
+     * @brief Serialization function for the cereal library (lets wheels persist the built tree)
+     *
+     * @see https://github.com/USCiLab/cereal
+     */
+    template <class Archive>
+    void serialize(Archive& archive) {
+        archive(tree, total);
+    }
+#endif
+};
@@ -0,0 +1,154 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <utility>
+
+/**
+ * @brief Owns at most one T, created on first use from the box's allocator.
+ *
+ * Lets a class keep rarely needed state out of line: an empty box is one pointer (plus the
+ * allocator when it has state), and the value is allocated only when getOrCreate is first
+ * called. Copies are deep, so the owning class keeps its implicit copy and move operations.
+ *
+ * @tparam T Stored type, constructible from const Allocator&
+ * @tparam Allocator Allocator the value is constructed with (rebound to T to allocate it)
+ */
+template<typename T, typename Allocator = std::allocator<T>>
+class LazyBox : private Allocator {
+public:
+    /**
+     * @brief Creates an empty box
+     * @param allocator Allocator for the value
+     */
+    explicit LazyBox(const Allocator& allocator = Allocator())
+        : Allocator(allocator) {
+    }
+
+    LazyBox(const LazyBox& other)
+        : Allocator(std::allocator_traits<Allocator>::select_on_container_copy_construction(other.allocator())) {
+        if (other.value != nullptr) {
+            value = create(*other.value);
+        }
+    }
+
+    LazyBox(LazyBox&& other) noexcept
+        : Allocator(std::move(other.allocator()))
+        , value(std::exchange(other.value, nullptr)) {
+    }
+
+    LazyBox& operator=(const LazyBox& other) {
+        if (this == &other) {
+            return *this;
+        }
+        if constexpr (std::allocator_traits<Allocator>::propagate_on_container_copy_assignment::value) {
+            if (allocator() != other.allocator()) {
+                reset();
+            }
+            allocator() = other.allocator();
+        }
+        copyValueFrom(other);
+        return *this;
+    }
+
+    LazyBox& operator=(LazyBox&& other) noexcept(
+        std::allocator_traits<Allocator>::propagate_on_container_move_assignment::value
+        || std::allocator_traits<Allocator>::is_always_equal::value) {
+        if (this == &other) {
+            return *this;
+        }
+        if constexpr (std::allocator_traits<Allocator>::propagate_on_container_move_assignment::value) {
+            reset();
+            allocator() = std::move(other.allocator());
+            value = std::exchange(other.value, nullptr);
+        } else {
+            if (allocator() == other.allocator()) {
+                reset();
+                value = std::exchange(other.value, nullptr);
+            } else {
+                // The value must live in this box's storage, so it is copied, not stolen
+                copyValueFrom(other);
+                other.reset();
+            }
+        }
+        return *this;
+    }
+
+    ~LazyBox() {
+        reset();
+    }
+
+    /**
+     * @brief Gets the value, if it has been created
+     * @return Pointer to the value, or nullptr
+     */
+    T* get() const noexcept {
+        return value;
+    }
+
+    /**
+     * @brief Gets the value, creating it from the allocator first if needed
+     * @return The value
+     */
+    T& getOrCreate() {
+        if (value == nullptr) {
+            value = create(allocator());
+        }
+        return *value;
+    }
+
+    /**
+     * @brief Destroys the value and frees its storage
+     */
+    void reset() noexcept {
+        if (value != nullptr) {
+            ValueAllocator storage = valueAllocator();
+            value->~T();
+            ValueAllocatorTraits::deallocate(storage, value, 1);
+            value = nullptr;
+        }
+    }
+
+private:
+    using ValueAllocator = typename std::allocator_traits<Allocator>::template rebind_alloc<T>;
+    using ValueAllocatorTraits = std::allocator_traits<ValueAllocator>;
+
+    T* value = nullptr;
+
+    Allocator& allocator() noexcept {
+        return *this;
+    }
+
+    const Allocator& allocator() const noexcept {
+        return *this;
+    }
+
+    ValueAllocator valueAllocator() const noexcept {
+        return ValueAllocator(allocator());
+    }
+
+    template<typename Argument>
+    T* create(const Argument& argument) {
+        ValueAllocator storage = valueAllocator();
+        T* created = ValueAllocatorTraits::allocate(storage, 1);
+        try {
+            // Placement new rather than allocator construct: T receives the allocator itself
+            ::new (static_cast<void*>(created)) T(argument);
+        } catch (...) {
+            ValueAllocatorTraits::deallocate(storage, created, 1);
+            throw;
+        }
+        return created;
+    }
+
+    void copyValueFrom(const LazyBox& other) {
+        if (other.value == nullptr) {
+            reset();
+        } else if (value == nullptr) {
+            value = create(*other.value);
+        } else {
+            *value = *other.value;
+        }
+    }
+};
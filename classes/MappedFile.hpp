@@ -0,0 +1,117 @@
+#pragma once
+
+#include <cstddef>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+#if !defined(_WIN32)
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+/**
+ * @brief A read-only view of a whole file, memory-mapped where the platform supports it.
+ *
+ * On POSIX systems the file is mmap'ed, so opening it costs no reads or copies and pages are
+ * loaded (and shared between processes) on first touch. Elsewhere the file is read into an
+ * owned buffer. The mapping is released when the object is destroyed.
+ */
+class MappedFile {
+public:
+    /**
+     * @brief Maps a file
+     * @param path Path of the file to map
+     * @throws std::runtime_error if the file cannot be opened or mapped
+     */
+    explicit MappedFile(const std::string& path) {
+#if !defined(_WIN32)
+        const int descriptor = ::open(path.c_str(), O_RDONLY);
+        if (descriptor < 0) {
+            throw std::runtime_error("MappedFile: cannot open " + path);
+        }
+        struct stat status {};
+        if (::fstat(descriptor, &status) != 0) {
+            ::close(descriptor);
+            throw std::runtime_error("MappedFile: cannot stat " + path);
+        }
+        length = static_cast<size_t>(status.st_size);
+        if (length > 0) {
+            void* mapping = ::mmap(nullptr, length, PROT_READ, MAP_PRIVATE, descriptor, 0);
+            if (mapping == MAP_FAILED) {
+                ::close(descriptor);
+                throw std::runtime_error("MappedFile: cannot map " + path);
+            }
+            address = mapping;
+        }
+        ::close(descriptor);
+#else
+        std::ifstream file(path, std::ios::binary | std::ios::ate);
+        if (!file) {
+            throw std::runtime_error("MappedFile: cannot open " + path);
+        }
+        length = static_cast<size_t>(file.tellg());
+        buffer.resize((length + sizeof(double) - 1) / sizeof(double));
+        file.seekg(0);
+        file.read(reinterpret_cast<char*>(buffer.data()), static_cast<std::streamsize>(length));
+        address = buffer.data();
+#endif
+    }
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    MappedFile(MappedFile&& other) noexcept
+        : address(std::exchange(other.address, nullptr))
+        , length(std::exchange(other.length, 0))
+        , buffer(std::move(other.buffer)) {
+    }
+
+    MappedFile& operator=(MappedFile&& other) noexcept {
+        if (this != &other) {
+            release();
+            address = std::exchange(other.address, nullptr);
+            length = std::exchange(other.length, 0);
+            buffer = std::move(other.buffer);
+        }
+        return *this;
+    }
+
+    ~MappedFile() {
+        release();
+    }
+
+    /**
+     * @brief Gets the start of the file's contents (page aligned when mapped)
+     * @return Pointer to the first byte, or nullptr for an empty file
+     */
+    const void* data() const {
+        return address;
+    }
+
+    /**
+     * @brief Gets the file's size
+     * @return Size in bytes
+     */
+    size_t size() const {
+        return length;
+    }
+
+private:
+    const void* address = nullptr;
+    size_t length = 0;
+    std::vector<double> buffer; ///< Owned copy where mapping is unavailable (double-aligned)
+
+    void release() {
+#if !defined(_WIN32)
+        if (address != nullptr) {
+            ::munmap(const_cast<void*>(address), length);
+        }
+#endif
+        address = nullptr;
+        length = 0;
+    }
+};
@@ -0,0 +1,115 @@
+#pragma once
+
+#include "ElementIndex.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <sstream>
+#include <stdexcept>
+#include <vector>
+
+/**
+ * @brief An immutable list of elements shared by many catalog-backed wheels.
+ *
+ * Elements are stored once and referred to by their position (an ItemId), so wheels built
+ * over the catalog hold only compact ids and weights. The catalog never changes after
+ * construction, which makes it safe to share between wheels and threads.
+ *
+ * @tparam E Element type to store
+ */
+template<typename E>
+class WheelCatalog {
+public:
+    /// Position of an element in the catalog
+    using ItemId = uint32_t;
+
+    /**
+     * @brief Creates a catalog that can be shared by wheels
+     * @param items The catalog's elements; an element's id is its position in this list
+     * @return Shared pointer to the new catalog
+     * @throws std::length_error if there are more items than ItemId can address
+     */
+    static std::shared_ptr<const WheelCatalog> create(std::vector<E> items) {
+        return std::make_shared<const WheelCatalog>(std::move(items));
+    }
+
+    /**
+     * @brief Creates a catalog (prefer create(), since wheels share catalogs by pointer)
+     * @param items The catalog's elements; an element's id is its position in this list
+     * @throws std::length_error if there are more items than ItemId can address
+     */
+    explicit WheelCatalog(std::vector<E> items) {
+        if (items.size() > UINT32_MAX) {
+            std::ostringstream msg;
+            msg << "WheelCatalog: " << items.size() << " items exceed the id range";
+            throw std::length_error(msg.str());
+        }
+        entries.reserve(items.size());
+        for (E& item : items) {
+            entries.push_back(Entry{std::move(item)});
+        }
+
+        // Build the index up front so later lookups only read it, even from several threads
+        if (!entries.empty()) {
+            elementIndex.find(entries.front().element, entries, entries.size());
+        }
+    }
+
+    /**
+     * @brief Gets the element with an id
+     * @param id The element's id
+     * @return Const reference to the element
+     * @throws std::out_of_range if id is not in the catalog
+     */
+    const E& at(ItemId id) const {
+        if (id >= entries.size()) {
+            std::ostringstream msg;
+            msg << "WheelCatalog::at: unknown item id " << id;
+            throw std::out_of_range(msg.str());
+        }
+        return entries[id].element;
+    }
+
+    /**
+     * @brief Gets the element with an id without checking the id
+     * @param id The element's id (must be less than size())
+     * @return Const reference to the element
+     */
+    const E& operator[](ItemId id) const {
+        return entries[id].element;
+    }
+
+    /**
+     * @brief Finds an element's id (O(1) for large catalogs of hashable elements)
+     * @param element The element to find
+     * @return Optional containing the id of the first equal element, or nullopt if not found
+     */
+    std::optional<ItemId> find(const E& element) const {
+        const auto index = elementIndex.find(element, entries, entries.size());
+        if (!index.has_value()) {
+            return std::nullopt;
+        }
+        return static_cast<ItemId>(*index);
+    }
+
+    /**
+     * @brief Gets the number of elements in the catalog
+     * @return Number of elements
+     */
+    size_t size() const {
+        return entries.size();
+    }
+
+private:
+    struct Entry {
+        E element;
+
+        const E& getElement() const {
+            return element;
+        }
+    };
+
+    std::vector<Entry> entries;
+    ElementIndex<E> elementIndex;
+};
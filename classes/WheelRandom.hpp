@@ -0,0 +1,80 @@
+#pragma once
+
+#include <stevensMathLib.h>
+#include <cstddef>
+#include <random>
+#include <type_traits>
+
+/**
+ * @brief Random draws shared by every wheel type.
+ *
+ * The random engine is only used at selection time and carries no per-wheel state,
+ * so a single engine is shared across all wheels rather than stored (and seeded)
+ * per instance. It is thread_local because std::mt19937 is not thread-safe and
+ * wheels may be used from worker threads (e.g. month resolution).
+ */
+class WheelRandom {
+public:
+    /**
+     * @brief Gets the shared random engine for the calling thread
+     * @return Reference to the thread's engine
+     */
+    static std::mt19937& engine() {
+        return stevensMathLib::getRandomEngine();
+    }
+
+    /**
+     * @brief Seeds the shared random engine for the calling thread
+     * @param seed The seed value
+     */
+    static void seed(unsigned int seed) {
+        stevensMathLib::setSeed(seed);
+    }
+
+    /**
+     * @brief Generates a random weight value in the range [0, maxWeight)
+     * @param maxWeight Upper bound (exclusive)
+     * @return Random weight value
+     */
+    template<typename W>
+    static W weightBelow(W maxWeight) {
+        if constexpr (std::is_integral_v<W>) {
+            std::uniform_int_distribution<W> distribution(0, maxWeight - 1);
+            return distribution(engine());
+        } else {
+            std::uniform_real_distribution<W> distribution(0.0, static_cast<double>(maxWeight));
+            return distribution(engine());
+        }
+    }
+
+    /**
+     * @brief Generates a uniformly distributed index in the range [0, count)
+     * @param count Number of candidate indices (must be positive)
+     * @return Random index
+     */
+    static size_t indexBelow(size_t count) {
+        std::uniform_int_distribution<size_t> distribution(0, count - 1);
+        return distribution(engine());
+    }
+
+    /**
+     * @brief Draws an index with probability proportional to its weight by scanning the
+     *        running total (the selection loop shared by the scanning wheels)
+     * @param count Number of weights (must be positive)
+     * @param weightAt Callable returning the weight at an index
+     * @param totalWeight Sum of the weights (must be positive)
+     * @return Selected index (the last one if floating-point rounding leaves the draw unmatched)
+     */
+    template<typename W, typename WeightAt>
+    static size_t indexByWeight(size_t count, WeightAt weightAt, W totalWeight) {
+        const W randomValue = weightBelow(totalWeight);
+        W accumulatedWeight = W{0};
+        for (size_t i = 0; i < count; ++i) {
+            accumulatedWeight += weightAt(i);
+            if (accumulatedWeight > randomValue) {
+                return i;
+            }
+        }
+        return count - 1;
+    }
+};
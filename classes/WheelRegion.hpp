@@ -32,6 +32,17 @@ public:
         , weight(weight) {
     }
 
+    /**
+     * @brief Constructs a wheel region whose element is built in place from the given arguments
+     * @param weight The probability weight for selecting this element
+     * @param args Arguments forwarded to the element's constructor
+     */
+    template<typename... Args>
+    WheelRegion(std::in_place_t, W weight, Args&&... args)
+        : element(std::forward<Args>(args)...)
+        , weight(weight) {
+    }
+
     /**
      * @brief Gets the element stored in this wheel region
      * @return Const reference to the element
@@ -40,6 +51,14 @@ public:
         return element;
     }
 
+    /**
+     * @brief Moves the element out of this wheel region
+     * @return The element; the region is left holding a moved-from element
+     */
+    E extractElement() {
+        return std::move(element);
+    }
+
     /**
      * @brief Gets the weight of this wheel region
      * @return The weight value
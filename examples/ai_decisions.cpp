@@ -43,11 +43,20 @@ int main() {
                   << combatAI.getSelectionProbability(region.getElement()) << "%\n";
     }
 
+    // Heal is not a legal action at full health; a filtered select skips it without
+    // copying the wheel or removing the region
+    const int maxHealth = 100;
+    int health = maxHealth;
+
     std::cout << "\nSimulating 10 combat turns:\n";
     for (int turn = 1; turn <= 10; ++turn) {
-        Action decision = combatAI.select();
-        std::cout << "  Turn " << turn << ": " << decision.name
+        Action decision = combatAI.selectIf([&](const Action& action) {
+            return action.name != "Heal" || health < maxHealth;
+        });
+        std::cout << "  Turn " << turn << " (HP " << health << "): " << decision.name
                   << " - " << decision.description << "\n";
+
+        health = decision.name == "Heal" ? maxHealth : health - 15;
     }
 
     // Example 2: Low Health - Defensive Behavior
@@ -109,10 +118,10 @@ int main() {
     };
 
     std::vector<std::tuple<Behavior, int>> peacefulBehaviors = {
-        {{{"Graze", "Peaceful"}}, 50},
-        {{{"Wander", "Peaceful"}}, 30},
-        {{{"Rest", "Peaceful"}}, 15},
-        {{{"Alert", "Peaceful"}}, 5}
+        {{"Graze", "Peaceful"}, 50},
+        {{"Wander", "Peaceful"}, 30},
+        {{"Rest", "Peaceful"}, 15},
+        {{"Alert", "Peaceful"}, 5}
     };
 
     RouletteWheel<Behavior, int> wildlifeAI(peacefulBehaviors);
@@ -1,7 +1,9 @@
 #include "../RouletteWheel.hpp"
+#include "../HierarchicalRouletteWheel.hpp"
 #include <iostream>
 #include <string>
 #include <map>
+#include <vector>
 
 // Represents an item that can be looted
 struct Item {
@@ -58,10 +60,12 @@ int main() {
     std::cout << "Loot Table Probabilities:\n";
     std::cout << "-------------------------\n";
 
+    // One pass for the whole table instead of an element lookup per row
+    const std::vector<double> dropRates = treasureChest.probabilities();
     std::map<std::string, double> rarityProbabilities;
-    for (const auto& region : treasureChest.getRegions()) {
-        const Item& item = region.getElement();
-        double prob = treasureChest.getSelectionProbability(item);
+    for (size_t i = 0; i < dropRates.size(); ++i) {
+        const Item& item = treasureChest.getRegions()[i].getElement();
+        double prob = dropRates[i] * 100;
         std::cout << "  [" << item.rarity << "] " << item.name
                   << " - " << prob << "% (Value: " << item.value << " gold)\n";
 
@@ -168,6 +172,38 @@ int main() {
     std::cout << "\nTotal SSR Characters obtained: " << ssrCount << " / " << totalPulls
               << " (" << (ssrCount * 100.0 / totalPulls) << "%)\n";
 
+    // Tiered loot: pick a rarity, then an item within that rarity
+    std::cout << "\n\n=== Tiered Loot Table ===\n";
+    std::cout << "=========================\n\n";
+
+    HierarchicalRouletteWheel<Item, int> tieredChest;
+    const auto commonTier = tieredChest.addTier(tieredChest.root, 50);
+    const auto rareTier = tieredChest.addTier(tieredChest.root, 15);
+    const auto legendaryTier = tieredChest.addTier(tieredChest.root, 1);
+
+    // Item weights only matter within their tier
+    tieredChest.addElement(commonTier, {"Rusty Sword", "Common", 10}, 4);
+    tieredChest.addElement(commonTier, {"Wooden Shield", "Common", 15}, 3);
+    tieredChest.addElement(commonTier, {"Health Potion", "Common", 25}, 3);
+    tieredChest.addElement(rareTier, {"Enchanted Bow", "Rare", 150}, 8);
+    tieredChest.addElement(rareTier, {"Magic Ring", "Rare", 200}, 7);
+    tieredChest.addElement(legendaryTier, {"Excalibur", "Legendary", 2000}, 1);
+
+    const Item excalibur{"Excalibur", "Legendary", 2000};
+    std::cout << "Excalibur drop chance: "
+              << tieredChest.getSelectionProbability(legendaryTier, excalibur) * 100 << "%\n";
+
+    // A drop-rate event retunes the whole tier in one call, without touching its items
+    tieredChest.setTierWeight(legendaryTier, 10);
+    std::cout << "Excalibur drop chance during the event: "
+              << tieredChest.getSelectionProbability(legendaryTier, excalibur) * 100 << "%\n";
+
+    std::cout << "\nOpening 5 event chests:\n";
+    for (int i = 1; i <= 5; ++i) {
+        Item drop = tieredChest.select();
+        std::cout << "  Chest " << i << ": [" << drop.rarity << "] " << drop.name << "\n";
+    }
+
     std::cout << "\n=== End of Loot System Example ===\n";
 
     return 0;
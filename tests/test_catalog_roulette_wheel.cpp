@@ -0,0 +1,107 @@
+#include "../CatalogRouletteWheel.hpp"
+#include <gtest/gtest.h>
+#include <string>
+#include <vector>
+
+class CatalogRouletteWheelTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        wheel.seedRandom(42);
+    }
+
+    std::shared_ptr<const WheelCatalog<std::string>> catalog =
+        WheelCatalog<std::string>::create({"Sword", "Shield", "Potion", "Gem"});
+    CatalogRouletteWheel<std::string, int> wheel{catalog};
+};
+
+// Catalog Tests
+TEST_F(CatalogRouletteWheelTest, CatalogLooksUpItems) {
+    EXPECT_EQ(catalog->size(), 4u);
+    EXPECT_EQ(catalog->at(2), "Potion");
+    EXPECT_EQ(catalog->find("Gem"), 3u);
+    EXPECT_FALSE(catalog->find("Bow").has_value());
+    EXPECT_THROW(catalog->at(4), std::out_of_range);
+
+    // Large catalogs are hashed
+    std::vector<int> numbers;
+    for (int i = 0; i < 500; ++i) {
+        numbers.push_back(i * 3);
+    }
+    const auto large = WheelCatalog<int>::create(numbers);
+    EXPECT_EQ(large->find(300), 100u);
+    EXPECT_FALSE(large->find(301).has_value());
+}
+
+// Constructor Tests
+TEST_F(CatalogRouletteWheelTest, DefaultState) {
+    EXPECT_TRUE(wheel.empty());
+    EXPECT_EQ(wheel.getCatalog(), catalog);
+    EXPECT_THROW(wheel.select(), std::runtime_error);
+    EXPECT_FALSE(wheel.selectIdSafe().has_value());
+    EXPECT_THROW((CatalogRouletteWheel<std::string, int>(nullptr)), std::invalid_argument);
+}
+
+// Selection Tests
+TEST_F(CatalogRouletteWheelTest, SelectReturnsCatalogReference) {
+    wheel.addRegion(1, 5);
+    const std::string& selected = wheel.select();
+    EXPECT_EQ(selected, "Shield");
+    EXPECT_EQ(&selected, &(*catalog)[1]);
+    EXPECT_EQ(wheel.selectId(), 1u);
+}
+
+TEST_F(CatalogRouletteWheelTest, WheelsShareItemsWithDifferentWeights) {
+    CatalogRouletteWheel<std::string, int> other(catalog);
+    wheel.addRegion("Sword", 3);
+    wheel.addRegion("Potion", 1);
+    other.addRegion(0, 1);
+    other.addRegion(2, 3);
+
+    EXPECT_DOUBLE_EQ(wheel.getSelectionProbability(0), 0.75);
+    EXPECT_DOUBLE_EQ(other.getSelectionProbability(0), 0.25);
+    EXPECT_EQ(wheel.getSelectionProbability(3), 0.0);
+
+    int swordCount = 0;
+    const int iterations = 10000;
+    for (int i = 0; i < iterations; ++i) {
+        swordCount += other.select() == "Sword";
+    }
+    EXPECT_NEAR(swordCount * 100.0 / iterations, 25.0, 2.0);
+}
+
+// Modification Tests
+TEST_F(CatalogRouletteWheelTest, AddAndRemoveRegions) {
+    wheel.addRegion(0, 2);
+    wheel.addRegion("Sword", 2);
+    EXPECT_EQ(wheel.size(), 1u);
+    EXPECT_EQ(wheel.getIds(), std::vector<uint32_t>{0});
+    EXPECT_EQ(wheel.getWeights(), std::vector<int>{4});
+
+    EXPECT_THROW(wheel.addRegion(4, 1), std::out_of_range);
+    EXPECT_THROW(wheel.addRegion("Bow", 1), std::invalid_argument);
+    EXPECT_THROW(wheel.addRegion(1, 0), std::invalid_argument);
+
+    EXPECT_TRUE(wheel.removeElement(0));
+    EXPECT_FALSE(wheel.removeElement(0));
+    EXPECT_TRUE(wheel.empty());
+}
+
+TEST_F(CatalogRouletteWheelTest, RemovalKeepsOrderAndTotal) {
+    CatalogRouletteWheel<std::string, double> fractional(catalog);
+    fractional.addRegion(0, 0.1);
+    fractional.addRegion(1, 0.2);
+    fractional.addRegion(2, 0.3);
+    fractional.addRegion(3, 0.4);
+
+    EXPECT_TRUE(fractional.removeElement(1));
+    EXPECT_EQ(fractional.getIds(), (std::vector<uint32_t>{0, 2, 3}));
+    EXPECT_DOUBLE_EQ(fractional.getSelectionProbability(3), 0.4 / 0.8);
+
+    fractional.removeElement(0);
+    fractional.removeElement(2);
+    for (int i = 0; i < 100; ++i) {
+        EXPECT_EQ(fractional.select(), "Gem");
+    }
+    fractional.removeElement(3);
+    EXPECT_FALSE(fractional.selectIdSafe().has_value());
+}
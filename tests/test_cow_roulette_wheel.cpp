@@ -0,0 +1,179 @@
+#include "../CowRouletteWheel.hpp"
+#include <gtest/gtest.h>
+#include <map>
+#include <string>
+#include <vector>
+
+class CowRouletteWheelTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        wheel.seedRandom(42);
+    }
+
+    static RouletteWheel<std::string, int> makeSpawnWheel() {
+        RouletteWheel<std::string, int> spawns;
+        spawns.addRegion("Goblin", 50);
+        spawns.addRegion("Wolf", 30);
+        spawns.addRegion("Troll", 20);
+        return spawns;
+    }
+
+    CowRouletteWheel<std::string, int> wheel{makeSpawnWheel()};
+};
+
+// Constructor Tests
+TEST_F(CowRouletteWheelTest, WrapsBaseWheel) {
+    EXPECT_EQ(wheel.size(), 3u);
+    EXPECT_EQ(wheel.overlaySize(), 0u);
+    EXPECT_EQ(wheel.getTotalWeight(), 100);
+    EXPECT_DOUBLE_EQ(wheel.getSelectionProbability("Wolf"), 0.3);
+
+    using SpawnWheel = CowRouletteWheel<std::string, double>;
+    EXPECT_THROW(SpawnWheel(std::shared_ptr<const SpawnWheel::Wheel>()), std::invalid_argument);
+
+    SpawnWheel::Wheel tempered;
+    tempered.addRegion("a", 1.0);
+    tempered.setTemperature(2.0);
+    EXPECT_THROW(SpawnWheel{tempered}, std::invalid_argument);
+}
+
+// Copy-on-Write Tests
+TEST_F(CowRouletteWheelTest, CopiesShareBaseUntilOverlayGrows) {
+    CowRouletteWheel<std::string, int> zone = wheel;
+    EXPECT_TRUE(zone.sharesBaseWith(wheel));
+
+    zone.setWeight("Troll", 70);
+    zone.addRegion("Dragon", 10);
+    EXPECT_TRUE(zone.sharesBaseWith(wheel));
+    EXPECT_EQ(zone.overlaySize(), 2u);
+
+    // The edits stay in the copy
+    EXPECT_EQ(zone.getWeight("Troll"), 70);
+    EXPECT_EQ(wheel.getWeight("Troll"), 20);
+    EXPECT_EQ(wheel.getWeight("Dragon"), 0);
+    EXPECT_EQ(zone.size(), 4u);
+    EXPECT_EQ(zone.getTotalWeight(), 160);
+
+    zone.detach();
+    EXPECT_FALSE(zone.sharesBaseWith(wheel));
+    EXPECT_EQ(zone.overlaySize(), 0u);
+    EXPECT_EQ(zone.getTotalWeight(), 160);
+    EXPECT_EQ(zone.getBase().size(), 4u);
+}
+
+TEST_F(CowRouletteWheelTest, RemoveAndReAddBaseRegion) {
+    EXPECT_TRUE(wheel.removeElement("Goblin"));
+    EXPECT_FALSE(wheel.removeElement("Goblin"));
+    EXPECT_FALSE(wheel.setWeight("Goblin", 5));
+    EXPECT_EQ(wheel.size(), 2u);
+    EXPECT_EQ(wheel.getTotalWeight(), 50);
+    for (int i = 0; i < 1000; ++i) {
+        ASSERT_NE(wheel.select(), "Goblin");
+    }
+
+    wheel.addRegion("Goblin", 5);
+    EXPECT_EQ(wheel.size(), 3u);
+    EXPECT_EQ(wheel.getWeight("Goblin"), 5);
+}
+
+TEST_F(CowRouletteWheelTest, InvalidWeightsThrow) {
+    EXPECT_THROW(wheel.addRegion("Wolf", 0), std::invalid_argument);
+    EXPECT_THROW(wheel.setWeight("Wolf", -1), std::invalid_argument);
+    EXPECT_FALSE(wheel.setWeight("Dragon", 1));
+}
+
+// Selection Tests
+TEST_F(CowRouletteWheelTest, OverlayDistributionMatchesWeights) {
+    CowRouletteWheel<std::string, int> zone = wheel;
+    zone.setWeight("Goblin", 10);  // Goblin 10, Wolf 30, Troll 20, Dragon 40
+    zone.addRegion("Dragon", 40);
+
+    std::map<std::string, int> counts;
+    const int iterations = 20000;
+    for (int i = 0; i < iterations; ++i) {
+        counts[zone.select()]++;
+    }
+    EXPECT_NEAR(counts["Goblin"] * 100.0 / iterations, 10.0, 2.0);
+    EXPECT_NEAR(counts["Wolf"] * 100.0 / iterations, 30.0, 2.0);
+    EXPECT_NEAR(counts["Troll"] * 100.0 / iterations, 20.0, 2.0);
+    EXPECT_NEAR(counts["Dragon"] * 100.0 / iterations, 40.0, 2.0);
+}
+
+TEST_F(CowRouletteWheelTest, FullyOverriddenBaseSelectsFromTheOverlayOnly) {
+    RouletteWheel<std::string, float> base;
+    base.addRegion("a", 1.0f);
+    base.addRegion("b", 1.0f);
+    CowRouletteWheel<std::string, float> zone(std::move(base));
+    zone.setWeight("a", 0.1f);  // Every base region overridden: no untouched weight to fall back on
+    zone.setWeight("b", 0.2f);
+    zone.addRegion("c", 0.7f);
+
+    std::map<std::string, int> counts;
+    const int iterations = 20000;
+    for (int i = 0; i < iterations; ++i) {
+        counts[zone.select()]++;
+    }
+    EXPECT_NEAR(counts["a"] * 100.0 / iterations, 10.0, 2.0);
+    EXPECT_NEAR(counts["c"] * 100.0 / iterations, 70.0, 2.0);
+}
+
+TEST_F(CowRouletteWheelTest, LargeOverlayFoldsIntoPrivateBase) {
+    RouletteWheel<int, double> spawns;
+    for (int i = 0; i < 100; ++i) {
+        spawns.addRegion(i, 1.0);
+    }
+    CowRouletteWheel<int, double> shared(std::move(spawns));
+    CowRouletteWheel<int, double> zone = shared;
+
+    for (int i = 0; i < 8; ++i) {
+        zone.setWeight(i, 2.0);
+    }
+    EXPECT_TRUE(zone.sharesBaseWith(shared));
+
+    zone.removeElement(8);
+    EXPECT_FALSE(zone.sharesBaseWith(shared));
+    EXPECT_EQ(zone.size(), 99u);
+    EXPECT_DOUBLE_EQ(zone.getTotalWeight(), 107.0);
+    EXPECT_DOUBLE_EQ(zone.getSelectionProbability(0), 2.0 / 107.0);
+    EXPECT_DOUBLE_EQ(shared.getTotalWeight(), 100.0);
+}
+
+TEST_F(CowRouletteWheelTest, DetachKeepsTheBaseOptionsAndDistribution) {
+    using Wheel = RouletteWheel<int, double>;
+    Wheel::Options options;
+    options.ignoreInvalidWeights = false;
+    options.strategy = WheelStrategy::PrefixSum;
+    options.indexElements = true;
+    Wheel spawns(options);
+    for (int i = 0; i < 100; ++i) {
+        spawns.addRegion(i, 1.0 + i % 5);
+    }
+    CowRouletteWheel<int, double> zone(std::move(spawns));
+
+    zone.setWeight(3, 9.0);
+    zone.removeElement(4);
+    zone.addRegion(100, 6.0);
+    std::vector<double> before;
+    for (int i = 0; i <= 100; ++i) {
+        before.push_back(zone.getSelectionProbability(i));
+    }
+
+    zone.detach();
+
+    EXPECT_EQ(zone.overlaySize(), 0u);
+    EXPECT_EQ(zone.size(), 100u);
+    for (int i = 0; i <= 100; ++i) {
+        EXPECT_DOUBLE_EQ(zone.getBase().getSelectionProbability(i), before[i]);
+    }
+    const Wheel::Options& kept = zone.getBase().getOptions();
+    EXPECT_FALSE(kept.ignoreInvalidWeights);
+    EXPECT_EQ(kept.strategy, WheelStrategy::PrefixSum);
+    EXPECT_TRUE(kept.indexElements);
+
+    // An automatic base stays automatic instead of being pinned to its current engine
+    CowRouletteWheel<std::string, int> automatic{makeSpawnWheel()};
+    automatic.removeElement("Wolf");
+    automatic.detach();
+    EXPECT_EQ(automatic.getBase().getStrategy(), WheelStrategy::Automatic);
+    EXPECT_DOUBLE_EQ(automatic.getSelectionProbability("Goblin"), 50.0 / 70.0);
+}
@@ -0,0 +1,108 @@
+#include "../DecayingRouletteWheel.hpp"
+#include <gtest/gtest.h>
+#include <cmath>
+#include <string>
+
+class DecayingRouletteWheelTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        wheel.seedRandom(42);
+    }
+
+    // One half-life per time unit
+    DecayingRouletteWheel<std::string> wheel{std::log(2.0)};
+};
+
+// Constructor Tests
+TEST_F(DecayingRouletteWheelTest, DefaultState) {
+    EXPECT_TRUE(wheel.empty());
+    EXPECT_EQ(wheel.getTime(), 0.0);
+    EXPECT_THROW(wheel.select(), std::runtime_error);
+    EXPECT_FALSE(wheel.selectSafe().has_value());
+}
+
+TEST_F(DecayingRouletteWheelTest, InvalidArgumentsThrow) {
+    EXPECT_THROW(DecayingRouletteWheel<int>(-1.0), std::invalid_argument);
+    EXPECT_THROW(wheel.addRegion("a", -1.0), std::invalid_argument);
+    EXPECT_THROW(wheel.addRegion("a", 0.0), std::invalid_argument);
+
+    wheel.advanceTo(5.0);
+    EXPECT_THROW(wheel.advanceTo(4.0), std::invalid_argument);
+}
+
+// Decay Tests
+TEST_F(DecayingRouletteWheelTest, WeightsHalveEveryHalfLife) {
+    wheel.addRegion("a", 8.0);
+    wheel.advanceBy(1.0);
+    EXPECT_NEAR(wheel.getWeight("a"), 4.0, 1e-12);
+    wheel.advanceTo(3.0);
+    EXPECT_NEAR(wheel.getWeight("a"), 1.0, 1e-12);
+
+    // New weight is added at full strength on top of the decayed weight
+    wheel.addRegion("a", 1.0);
+    EXPECT_NEAR(wheel.getWeight("a"), 2.0, 1e-12);
+    EXPECT_NEAR(wheel.getTotalWeight(), 2.0, 1e-12);
+}
+
+TEST_F(DecayingRouletteWheelTest, OlderWeightsAreLessLikely) {
+    wheel.addRegion("old", 1.0);
+    wheel.advanceBy(1.0);
+    wheel.addRegion("new", 1.0);
+
+    EXPECT_NEAR(wheel.getSelectionProbability("old"), 1.0 / 3.0, 1e-12);
+
+    int oldCount = 0;
+    const int iterations = 10000;
+    for (int i = 0; i < iterations; ++i) {
+        oldCount += wheel.select() == "old";
+    }
+    EXPECT_NEAR(oldCount * 100.0 / iterations, 100.0 / 3.0, 2.0);
+}
+
+TEST_F(DecayingRouletteWheelTest, BonusesDecayToBaseWeight) {
+    wheel.addRegion("fresh", 3.0, 1.0);  // Novelty bonus of 3 on a permanent weight of 1
+    wheel.addRegion("stale", 0.0, 1.0);
+    EXPECT_DOUBLE_EQ(wheel.getSelectionProbability("fresh"), 0.8);
+
+    wheel.advanceBy(60.0);
+    EXPECT_NEAR(wheel.getSelectionProbability("fresh"), 0.5, 1e-9);
+
+    wheel.setWeight("stale", 2.0);
+    EXPECT_NEAR(wheel.getWeight("stale"), 3.0, 1e-9);
+}
+
+TEST_F(DecayingRouletteWheelTest, LongIdleWheelsKeepTheirProportions) {
+    wheel.addRegion("a", 1.0);
+    wheel.addRegion("b", 3.0);
+
+    // The shared decay factor underflows long before this, but it cancels out
+    wheel.advanceBy(5000.0);
+    EXPECT_DOUBLE_EQ(wheel.getSelectionProbability("b"), 0.75);
+    EXPECT_NO_THROW(wheel.select());
+
+    // A write this far out rebases the stored weights; the idle ones are now negligible
+    wheel.addRegion("c", 1.0);
+    EXPECT_DOUBLE_EQ(wheel.getSelectionProbability("c"), 1.0);
+    for (int i = 0; i < 100; ++i) {
+        EXPECT_EQ(wheel.select(), "c");
+    }
+}
+
+TEST_F(DecayingRouletteWheelTest, RemoveElementKeepsLookupsCorrect) {
+    DecayingRouletteWheel<int> large(0.1);
+    for (int i = 0; i < 200; ++i) {
+        large.addRegion(i, 1.0 + i);
+    }
+    EXPECT_TRUE(large.removeElement(10));
+    EXPECT_TRUE(large.removeElement(199));
+    EXPECT_FALSE(large.removeElement(10));
+
+    EXPECT_EQ(large.size(), 198);
+    EXPECT_DOUBLE_EQ(large.getWeight(198), 199.0);
+    EXPECT_DOUBLE_EQ(large.getWeight(10), 0.0);
+    for (int i = 0; i < 1000; ++i) {
+        const int selected = large.select();
+        ASSERT_NE(selected, 10);
+        ASSERT_NE(selected, 199);
+    }
+}
@@ -0,0 +1,120 @@
+#include "../DepletableRouletteWheel.hpp"
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <map>
+#include <set>
+#include <string>
+#include <tuple>
+#include <vector>
+
+class DepletableRouletteWheelTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        WheelRandom::seed(42);
+    }
+
+    static DepletableRouletteWheel<int, int> standardDeck() {
+        DepletableRouletteWheel<int, int> deck;
+        for (int card = 0; card < 52; ++card) {
+            deck.addRegion(card, 1);
+        }
+        return deck;
+    }
+};
+
+// Construction Tests
+TEST_F(DepletableRouletteWheelTest, DefaultState) {
+    DepletableRouletteWheel<std::string, double> wheel;
+    EXPECT_TRUE(wheel.empty());
+    EXPECT_EQ(wheel.fullSize(), 0u);
+    EXPECT_THROW(wheel.select(), std::runtime_error);
+    EXPECT_THROW(wheel.selectAndRemove(), std::runtime_error);
+    EXPECT_THROW(wheel.addRegion("a", 0.0), std::invalid_argument);
+}
+
+// Drain and Reset Tests
+TEST_F(DepletableRouletteWheelTest, DrainingDrawsEveryCardOnce) {
+    auto deck = standardDeck();
+    std::set<int> drawn;
+    while (!deck.empty()) {
+        drawn.insert(deck.selectAndRemove());
+    }
+    EXPECT_EQ(drawn.size(), 52u);
+    EXPECT_EQ(deck.removedCount(), 52u);
+    EXPECT_EQ(deck.getActiveWeight(), 0);
+}
+
+TEST_F(DepletableRouletteWheelTest, ResetRestoresTheFullDeckWithoutMovingElements) {
+    DepletableRouletteWheel<std::string, double> wheel({{"common", 10.0}, {"rare", 3.0}, {"mythic", 0.5}});
+    const std::string* storage = &wheel.getRegions()[0].getElement();
+
+    wheel.selectAndRemove();
+    wheel.selectAndRemove();
+    EXPECT_EQ(wheel.size(), 1u);
+
+    wheel.reset();
+    EXPECT_EQ(wheel.size(), 3u);
+    EXPECT_EQ(wheel.removedCount(), 0u);
+    EXPECT_DOUBLE_EQ(wheel.getActiveWeight(), 13.5);
+    EXPECT_EQ(&wheel.getRegions()[0].getElement(), storage);
+    EXPECT_EQ(wheel.getRegions()[1].getElement(), "rare");
+}
+
+TEST_F(DepletableRouletteWheelTest, AddingAfterDrawsKeepsRemovedRegionsInactive) {
+    DepletableRouletteWheel<std::string, int> wheel({{"a", 1}, {"b", 2}});
+    const std::string first = wheel.selectAndRemove();
+    wheel.addRegion("c", 5);
+
+    EXPECT_EQ(wheel.size(), 2u);
+    EXPECT_EQ(wheel.fullSize(), 3u);
+    for (int i = 0; i < 100; ++i) {
+        EXPECT_NE(wheel.select(), first);
+    }
+    wheel.reset();
+    EXPECT_EQ(wheel.getActiveWeight(), 8);
+}
+
+// Statistical Tests
+TEST_F(DepletableRouletteWheelTest, FirstDrawIsProportionalToWeight) {
+    DepletableRouletteWheel<std::string, double> wheel({{"a", 1.0}, {"b", 3.0}, {"c", 6.0}});
+    std::map<std::string, int> counts;
+    const int iterations = 20000;
+    for (int i = 0; i < iterations; ++i) {
+        ++counts[wheel.selectAndRemove()];
+        wheel.reset();
+    }
+    EXPECT_NEAR(static_cast<double>(counts["a"]) / iterations, 0.1, 0.015);
+    EXPECT_NEAR(static_cast<double>(counts["b"]) / iterations, 0.3, 0.015);
+    EXPECT_NEAR(static_cast<double>(counts["c"]) / iterations, 0.6, 0.015);
+}
+
+TEST_F(DepletableRouletteWheelTest, SecondDrawRenormalisesOverTheRest) {
+    // After "c" (weight 6) is drawn first, "b" should follow 3/4 of the time
+    DepletableRouletteWheel<std::string, double> wheel({{"a", 1.0}, {"b", 3.0}, {"c", 6.0}});
+    int afterC = 0;
+    int bAfterC = 0;
+    for (int i = 0; i < 40000; ++i) {
+        if (wheel.selectAndRemove() == "c") {
+            ++afterC;
+            bAfterC += wheel.selectAndRemove() == "b";
+        }
+        wheel.reset();
+    }
+    EXPECT_NEAR(static_cast<double>(bAfterC) / afterC, 0.75, 0.015);
+}
+
+TEST_F(DepletableRouletteWheelTest, ManyDrainCyclesKeepTheWeightExact) {
+    DepletableRouletteWheel<int, double> wheel;
+    double expected = 0.0;
+    for (int i = 0; i < 1000; ++i) {
+        wheel.addRegion(i, 0.1 + (i % 17) * 0.3);
+        expected += 0.1 + (i % 17) * 0.3;
+    }
+    for (int cycle = 0; cycle < 200; ++cycle) {
+        for (int draw = 0; draw < 1 + cycle % 50; ++draw) {
+            wheel.selectAndRemove();
+        }
+        wheel.reset();
+    }
+    EXPECT_NEAR(wheel.getActiveWeight(), expected, 1e-6);
+}
@@ -0,0 +1,101 @@
+#include "../FrozenRouletteWheel.hpp"
+#include <gtest/gtest.h>
+#include <string_view>
+#include <unordered_map>
+
+namespace {
+
+enum class Rarity { Common, Uncommon, Rare, Epic, Legendary };
+
+constexpr auto weather = makeFrozenRouletteWheel<std::string_view, int>({
+    {"Sunny", 50}, {"Cloudy", 30}, {"Rainy", 15}, {"Stormy", 5}
+});
+
+constexpr auto rarity = makeFrozenRouletteWheel<Rarity, double>({
+    {Rarity::Common, 60.0}, {Rarity::Uncommon, 25.0}, {Rarity::Rare, 10.0},
+    {Rarity::Epic, 4.0}, {Rarity::Legendary, 1.0}
+});
+
+// Reconstructs a region's probability mass (in units of total weight) from the alias table
+template<typename Wheel>
+constexpr typename Wheel::Threshold aliasMass(const Wheel& wheel, size_t region) {
+    typename Wheel::Threshold mass{};
+    for (size_t column = 0; column < Wheel::size(); ++column) {
+        if (column == region) {
+            mass += wheel.getThreshold(column);
+        }
+        if (wheel.getAlias(column) == region && wheel.getAlias(column) != column) {
+            mass += static_cast<typename Wheel::Threshold>(wheel.getTotalWeight()) - wheel.getThreshold(column);
+        }
+    }
+    return mass;
+}
+
+// Compile-time checks: the tables below are computed entirely by the compiler
+static_assert(weather.size() == 4);
+static_assert(weather.getTotalWeight() == 100);
+static_assert(weather.getElement(2) == "Rainy");
+static_assert(weather.getSelectionProbability("Sunny") == 0.5);
+static_assert(weather.getSelectionProbability("Snowy") == 0.0);
+static_assert(aliasMass(weather, 0) == 50 * 4);
+static_assert(aliasMass(weather, 1) == 30 * 4);
+static_assert(aliasMass(weather, 2) == 15 * 4);
+static_assert(aliasMass(weather, 3) == 5 * 4);
+static_assert(rarity.getTotalWeight() == 100.0);
+static_assert(rarity.getSelectionProbability(Rarity::Legendary) == 0.01);
+
+} // namespace
+
+class FrozenRouletteWheelTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        WheelRandom::seed(42);
+    }
+};
+
+TEST_F(FrozenRouletteWheelTest, AliasTableConservesMassForFloatingWeights) {
+    for (size_t i = 0; i < rarity.size(); ++i) {
+        EXPECT_NEAR(aliasMass(rarity, i), rarity.getWeight(i) * rarity.size(), 1e-9);
+    }
+}
+
+TEST_F(FrozenRouletteWheelTest, SelectDistributionIntegerWeights) {
+    std::unordered_map<std::string_view, int> counts;
+    const int iterations = 20000;
+
+    for (int i = 0; i < iterations; ++i) {
+        counts[weather.select()]++;
+    }
+
+    EXPECT_NEAR(counts["Sunny"] * 100.0 / iterations, 50.0, 2.0);
+    EXPECT_NEAR(counts["Cloudy"] * 100.0 / iterations, 30.0, 2.0);
+    EXPECT_NEAR(counts["Rainy"] * 100.0 / iterations, 15.0, 2.0);
+    EXPECT_NEAR(counts["Stormy"] * 100.0 / iterations, 5.0, 2.0);
+}
+
+TEST_F(FrozenRouletteWheelTest, SelectDistributionFloatingWeights) {
+    int commonCount = 0;
+    const int iterations = 20000;
+
+    for (int i = 0; i < iterations; ++i) {
+        if (rarity.select() == Rarity::Common) {
+            ++commonCount;
+        }
+    }
+
+    EXPECT_NEAR(commonCount * 100.0 / iterations, 60.0, 2.0);
+}
+
+TEST_F(FrozenRouletteWheelTest, SingleRegionAlwaysSelected) {
+    constexpr auto single = makeFrozenRouletteWheel<char, int>({{'x', 7}});
+    static_assert(single.getThreshold(0) == 7);
+
+    for (int i = 0; i < 100; ++i) {
+        EXPECT_EQ(single.select(), 'x');
+    }
+}
+
+TEST_F(FrozenRouletteWheelTest, RuntimeConstructionRejectsInvalidWeights) {
+    std::array<std::pair<int, int>, 2> entries = {{{1, 5}, {2, 0}}};
+    EXPECT_THROW((FrozenRouletteWheel<int, int, 2>(entries)), std::invalid_argument);
+}
@@ -0,0 +1,99 @@
+#include "../FrozenWheelView.hpp"
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <tuple>
+#include <vector>
+
+class FrozenWheelViewTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        WheelRandom::seed(42);
+        std::ostringstream out(std::ios::binary);
+        FrozenWheelView::write(out, std::vector<std::tuple<std::uint32_t, int>>{{7, 10}, {3, 30}, {9, 60}});
+        const std::string bytes = out.str();
+        image.resize((bytes.size() + 7) / 8);
+        std::memcpy(image.data(), bytes.data(), bytes.size());
+        imageSize = bytes.size();
+    }
+
+    std::vector<double> image; ///< 8-byte aligned copy of the written image
+    size_t imageSize = 0;
+};
+
+// Round-Trip Tests
+TEST_F(FrozenWheelViewTest, RoundTripInMemory) {
+    const FrozenWheelView view(image.data(), imageSize);
+    EXPECT_EQ(view.size(), 3u);
+    EXPECT_DOUBLE_EQ(view.getTotalWeight(), 100.0);
+    EXPECT_EQ(view.getElementId(1), 3u);
+    EXPECT_DOUBLE_EQ(view.getWeight(2), 60.0);
+    EXPECT_DOUBLE_EQ(view.getSelectionProbability(0), 0.1);
+
+    std::map<std::uint32_t, int> counts;
+    const int iterations = 20000;
+    for (int i = 0; i < iterations; ++i) {
+        counts[view.select()]++;
+    }
+    EXPECT_EQ(counts.size(), 3u);
+    EXPECT_NEAR(counts[7] * 100.0 / iterations, 10.0, 2.0);
+    EXPECT_NEAR(counts[3] * 100.0 / iterations, 30.0, 2.0);
+    EXPECT_NEAR(counts[9] * 100.0 / iterations, 60.0, 2.0);
+}
+
+TEST_F(FrozenWheelViewTest, RoundTripThroughMappedFile) {
+    const std::filesystem::path path = std::filesystem::temp_directory_path() / "roulette_wheel_view_test.bin";
+    std::vector<std::tuple<std::uint32_t, double>> table;
+    for (std::uint32_t i = 0; i < 1000; ++i) {
+        table.emplace_back(i * 2, 0.5 + i % 7);
+    }
+    {
+        std::ofstream out(path, std::ios::binary);
+        FrozenWheelView::write(out, table);
+    }
+
+    {
+        const MappedFile file(path.string());
+        const FrozenWheelView view(file);
+        ASSERT_EQ(view.size(), 1000u);
+        for (size_t i = 0; i < view.size(); ++i) {
+            ASSERT_EQ(view.getElementId(i), std::get<0>(table[i]));
+            ASSERT_DOUBLE_EQ(view.getWeight(i), std::get<1>(table[i]));
+        }
+        for (int i = 0; i < 1000; ++i) {
+            ASSERT_EQ(view.select() % 2, 0u);
+        }
+    }
+    std::filesystem::remove(path);
+}
+
+// Validation Tests
+TEST_F(FrozenWheelViewTest, RejectsInvalidImages) {
+    EXPECT_THROW(FrozenWheelView(image.data(), imageSize - 8), std::runtime_error);
+    EXPECT_THROW(FrozenWheelView(image.data(), 16), std::runtime_error);
+
+    std::vector<double> corrupted = image;
+    reinterpret_cast<char*>(corrupted.data())[0] = 'X';
+    EXPECT_THROW(FrozenWheelView(corrupted.data(), imageSize), std::runtime_error);
+
+    corrupted = image;
+    reinterpret_cast<FrozenWheelView::FrozenWheelHeader*>(corrupted.data())->version = 99;
+    EXPECT_THROW(FrozenWheelView(corrupted.data(), imageSize), std::runtime_error);
+
+    corrupted = image;
+    reinterpret_cast<FrozenWheelView::FrozenWheelHeader*>(corrupted.data())->elementIdsOffset = imageSize;
+    EXPECT_THROW(FrozenWheelView(corrupted.data(), imageSize), std::runtime_error);
+
+    EXPECT_THROW(MappedFile("/nonexistent/roulette_wheel.bin"), std::runtime_error);
+}
+
+TEST_F(FrozenWheelViewTest, WriteRejectsInvalidTables) {
+    std::ostringstream out(std::ios::binary);
+    EXPECT_THROW(FrozenWheelView::write(out, std::vector<std::tuple<std::uint32_t, int>>{}), std::invalid_argument);
+    EXPECT_THROW(FrozenWheelView::write(out, std::vector<std::tuple<std::uint32_t, int>>{{1, 0}}), std::invalid_argument);
+}
@@ -0,0 +1,195 @@
+#include "../HierarchicalRouletteWheel.hpp"
+#include <gtest/gtest.h>
+#include <map>
+#include <string>
+
+class HierarchicalRouletteWheelTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        wheel.seedRandom(42);
+    }
+
+    HierarchicalRouletteWheel<std::string, int> wheel;
+};
+
+// Construction Tests
+TEST_F(HierarchicalRouletteWheelTest, DefaultConstructor) {
+    EXPECT_TRUE(wheel.empty());
+    EXPECT_EQ(wheel.size(), 0);
+    EXPECT_EQ(wheel.tierCount(), 1);
+    EXPECT_EQ(wheel.getTierWeight(wheel.root), 0);
+}
+
+TEST_F(HierarchicalRouletteWheelTest, AddElementCombinesWeightsWithinTier) {
+    const auto tier = wheel.addTier(wheel.root);
+    wheel.addElement(tier, "sword", 5);
+    wheel.addElement(tier, "sword", 3);
+    wheel.addElement(wheel.root, "sword", 2);
+
+    EXPECT_EQ(wheel.size(), 2);
+    EXPECT_EQ(wheel.getTierTotal(tier), 8);
+    EXPECT_EQ(wheel.getTierTotal(wheel.root), 10);
+}
+
+TEST_F(HierarchicalRouletteWheelTest, InvalidArgumentsThrow) {
+    const auto tier = wheel.addTier(wheel.root, 10);
+
+    EXPECT_THROW(wheel.addElement(tier, "a", 0), std::invalid_argument);
+    EXPECT_THROW(wheel.addTier(tier, -1), std::invalid_argument);
+    EXPECT_THROW(wheel.setTierWeight(tier, 0), std::invalid_argument);
+    EXPECT_THROW(wheel.addElement(7, "a", 1), std::out_of_range);
+    EXPECT_THROW(wheel.setTierWeight(wheel.root, 5), std::out_of_range);
+}
+
+// Selection Tests
+TEST_F(HierarchicalRouletteWheelTest, SelectThrowsOnEmptyWheel) {
+    wheel.addTier(wheel.root, 10);
+
+    EXPECT_THROW(wheel.select(), std::runtime_error);
+    EXPECT_FALSE(wheel.selectSafe().has_value());
+}
+
+TEST_F(HierarchicalRouletteWheelTest, FixedTierWeightsIgnoreContents) {
+    const auto common = wheel.addTier(wheel.root, 90);
+    const auto rare = wheel.addTier(wheel.root, 10);
+    for (int i = 0; i < 9; ++i) {
+        wheel.addElement(common, "common" + std::to_string(i), 100);
+    }
+    wheel.addElement(rare, "gem", 1);
+
+    EXPECT_DOUBLE_EQ(wheel.getSelectionProbability(rare, "gem"), 0.1);
+    EXPECT_DOUBLE_EQ(wheel.getSelectionProbability(common, "common0"), 0.1);
+
+    int gems = 0;
+    const int trials = 20000;
+    for (int i = 0; i < trials; ++i) {
+        gems += wheel.select() == "gem";
+    }
+    EXPECT_NEAR(gems / static_cast<double>(trials), 0.1, 0.01);
+}
+
+TEST_F(HierarchicalRouletteWheelTest, EmptyTiersAreNeverSelected) {
+    const auto filled = wheel.addTier(wheel.root, 1);
+    wheel.addTier(wheel.root, 1000);
+    wheel.addElement(filled, "only", 1);
+
+    EXPECT_EQ(wheel.getTierWeight(wheel.root), 1);
+    for (int i = 0; i < 100; ++i) {
+        EXPECT_EQ(wheel.select(), "only");
+    }
+}
+
+TEST_F(HierarchicalRouletteWheelTest, SelectDistributionAcrossThreeLevels) {
+    HierarchicalRouletteWheel<int, double> nested;
+    nested.seedRandom(7);
+    const auto left = nested.addTier(nested.root, 3.0);
+    const auto right = nested.addTier(nested.root);
+    const auto deep = nested.addTier(right, 1.0);
+    nested.addElement(left, 0, 1.0);
+    nested.addElement(right, 1, 1.0);
+    nested.addElement(deep, 2, 0.25);
+    nested.addElement(deep, 3, 0.75);
+
+    // right follows its contents: 1.0 + fixed 1.0 for deep = 2.0, against left's fixed 3.0
+    EXPECT_DOUBLE_EQ(nested.getTierWeight(right), 2.0);
+    const double expected[] = {0.6, 0.2, 0.05, 0.15};
+
+    std::map<int, int> counts;
+    const int trials = 40000;
+    for (int i = 0; i < trials; ++i) {
+        counts[nested.select()]++;
+    }
+    for (int element = 0; element < 4; ++element) {
+        EXPECT_DOUBLE_EQ(nested.getSelectionProbability(element < 1 ? left : element < 2 ? right : deep, element),
+                         expected[element]);
+        EXPECT_NEAR(counts[element] / static_cast<double>(trials), expected[element], 0.01);
+    }
+}
+
+// Propagation Tests
+TEST_F(HierarchicalRouletteWheelTest, ContentChangesPropagateUntilFixedTier) {
+    const auto fixed = wheel.addTier(wheel.root, 50);
+    const auto following = wheel.addTier(fixed);
+    wheel.addElement(following, "a", 4);
+    wheel.addElement(following, "b", 6);
+
+    EXPECT_EQ(wheel.getTierWeight(following), 10);
+    EXPECT_EQ(wheel.getTierTotal(fixed), 10);
+    EXPECT_EQ(wheel.getTierTotal(wheel.root), 50);
+
+    wheel.setElementWeight(following, "a", 14);
+    EXPECT_EQ(wheel.getTierWeight(following), 20);
+    EXPECT_EQ(wheel.getTierTotal(fixed), 20);
+    EXPECT_EQ(wheel.getTierTotal(wheel.root), 50);
+
+    wheel.followTierContents(fixed);
+    EXPECT_EQ(wheel.getTierTotal(wheel.root), 20);
+
+    wheel.setTierWeight(fixed, 5);
+    EXPECT_EQ(wheel.getTierTotal(wheel.root), 5);
+}
+
+TEST_F(HierarchicalRouletteWheelTest, RemoveElementUpdatesAncestors) {
+    const auto outer = wheel.addTier(wheel.root);
+    const auto inner = wheel.addTier(outer);
+    wheel.addElement(outer, "x", 2);
+    wheel.addElement(inner, "y", 3);
+    wheel.addElement(inner, "z", 5);
+
+    EXPECT_TRUE(wheel.removeElement(inner, "y"));
+    EXPECT_FALSE(wheel.removeElement(inner, "y"));
+    EXPECT_FALSE(wheel.removeElement(outer, "z"));
+    EXPECT_EQ(wheel.getTierTotal(wheel.root), 7);
+
+    EXPECT_TRUE(wheel.removeElement(inner, "z"));
+    EXPECT_EQ(wheel.getTierWeight(inner), 0);
+    EXPECT_EQ(wheel.getTierTotal(wheel.root), 2);
+    EXPECT_EQ(wheel.size(), 1);
+    for (int i = 0; i < 50; ++i) {
+        EXPECT_EQ(wheel.select(), "x");
+    }
+}
+
+TEST_F(HierarchicalRouletteWheelTest, RetuningTierLeavesContentsUntouched) {
+    const auto rare = wheel.addTier(wheel.root, 10);
+    const auto common = wheel.addTier(wheel.root, 90);
+    wheel.addElement(rare, "gem", 1);
+    wheel.addElement(rare, "crown", 3);
+    wheel.addElement(common, "coin", 1);
+
+    wheel.setTierWeight(rare, 90);
+
+    EXPECT_EQ(wheel.getTierTotal(rare), 4);
+    EXPECT_DOUBLE_EQ(wheel.getSelectionProbability(rare, "crown"), 0.5 * 0.75);
+    EXPECT_DOUBLE_EQ(wheel.getSelectionProbability(common, "coin"), 0.5);
+}
+
+// Lookup Tests
+TEST_F(HierarchicalRouletteWheelTest, WideTiersFindElementsAfterRemovals) {
+    HierarchicalRouletteWheel<int, int> wide;
+    const auto left = wide.addTier(wide.root);
+    const auto right = wide.addTier(wide.root);
+    for (int i = 0; i < 300; ++i) {
+        // Interleaved so removals move records of the other tier as well
+        wide.addElement(i % 2 == 0 ? left : right, i, 1);
+    }
+
+    for (int i = 0; i < 300; i += 3) {
+        EXPECT_TRUE(wide.removeElement(i % 2 == 0 ? left : right, i));
+    }
+    EXPECT_FALSE(wide.removeElement(left, 0));
+    EXPECT_FALSE(wide.removeElement(right, 2));
+    EXPECT_EQ(wide.size(), 200);
+
+    for (int i = 0; i < 300; ++i) {
+        const auto tier = i % 2 == 0 ? left : right;
+        const auto otherTier = i % 2 == 0 ? right : left;
+        EXPECT_EQ(wide.setElementWeight(tier, i, 2), i % 3 != 0) << i;
+        EXPECT_FALSE(wide.setElementWeight(otherTier, i, 2)) << i;
+    }
+    EXPECT_DOUBLE_EQ(wide.getSelectionProbability(left, 4), 1.0 / 200.0);
+
+    wide.addElement(left, 4, 2);
+    EXPECT_EQ(wide.size(), 200);
+    EXPECT_EQ(wide.getTierTotal(left), 202);
+}
@@ -0,0 +1,222 @@
+#include "../LogitRouletteWheel.hpp"
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cmath>
+#include <iterator>
+#include <limits>
+#include <string>
+#include <vector>
+
+class LogitRouletteWheelTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        wheel.seedRandom(42);
+    }
+
+    LogitRouletteWheel<std::string> wheel;
+};
+
+static constexpr double negativeInfinity = -std::numeric_limits<double>::infinity();
+
+// Constructor Tests
+TEST_F(LogitRouletteWheelTest, DefaultState) {
+    EXPECT_TRUE(wheel.empty());
+    EXPECT_EQ(wheel.getTemperature(), 1.0);
+    EXPECT_EQ(wheel.getLogNormalizer(), negativeInfinity);
+    EXPECT_THROW(wheel.select(), std::runtime_error);
+    EXPECT_THROW(wheel.selectGumbel(), std::runtime_error);
+    EXPECT_FALSE(wheel.selectSafe().has_value());
+}
+
+TEST_F(LogitRouletteWheelTest, InvalidArgumentsThrow) {
+    EXPECT_THROW(LogitRouletteWheel<int>(0.0), std::invalid_argument);
+    EXPECT_THROW(wheel.addRegion("a", std::nan("")), std::invalid_argument);
+    EXPECT_THROW(wheel.addRegion("a", std::numeric_limits<double>::infinity()), std::invalid_argument);
+    EXPECT_THROW(wheel.addRegion("a", negativeInfinity), std::invalid_argument);
+
+    wheel.addRegion("a", 0.0);
+    const double logWeights[] = {0.0, 1.0};
+    EXPECT_THROW(wheel.setLogWeights(logWeights, 2), std::invalid_argument);
+}
+
+// Probability Tests
+TEST_F(LogitRouletteWheelTest, ProbabilitiesAreSoftmax) {
+    wheel.addRegion("a", std::log(1.0));
+    wheel.addRegion("b", std::log(3.0));
+
+    EXPECT_NEAR(wheel.getSelectionProbability("a"), 0.25, 1e-12);
+    EXPECT_NEAR(wheel.getLogNormalizer(), std::log(4.0), 1e-12);
+    EXPECT_EQ(wheel.getSelectionProbability("missing"), 0.0);
+
+    // Adding to an existing region adds the weights, not the log-weights
+    wheel.addRegion("a", std::log(2.0));
+    EXPECT_NEAR(wheel.getLogWeight("a"), std::log(3.0), 1e-12);
+    EXPECT_NEAR(wheel.getSelectionProbability("a"), 0.5, 1e-12);
+
+    int aCount = 0;
+    const int iterations = 10000;
+    for (int i = 0; i < iterations; ++i) {
+        aCount += wheel.select() == "a";
+    }
+    EXPECT_NEAR(aCount * 100.0 / iterations, 50.0, 2.0);
+}
+
+TEST_F(LogitRouletteWheelTest, TemperatureFlattensAndSharpens) {
+    wheel.addRegion("a", 0.0);
+    wheel.addRegion("b", std::log(4.0));
+
+    wheel.setTemperature(2.0);
+    EXPECT_NEAR(wheel.getSelectionProbability("b"), 2.0 / 3.0, 1e-12);
+
+    wheel.setTemperature(0.5);
+    EXPECT_NEAR(wheel.getSelectionProbability("b"), 16.0 / 17.0, 1e-12);
+}
+
+// Numerical Accuracy Tests
+TEST_F(LogitRouletteWheelTest, VeryNegativeLogitsDoNotUnderflow) {
+    // exp(-800) is 0 in double precision; only the difference between the logits matters
+    wheel.addRegion("a", -800.0);
+    wheel.addRegion("b", -800.0 + std::log(3.0));
+
+    EXPECT_NEAR(wheel.getSelectionProbability("a"), 0.25, 1e-12);
+    EXPECT_NEAR(wheel.getLogNormalizer(), -800.0 + std::log(4.0), 1e-9);
+
+    int aCount = 0;
+    const int iterations = 10000;
+    for (int i = 0; i < iterations; ++i) {
+        aCount += wheel.select() == "a";
+    }
+    EXPECT_NEAR(aCount * 100.0 / iterations, 25.0, 2.0);
+}
+
+TEST_F(LogitRouletteWheelTest, LogitsSpanningHundredsOfNats) {
+    wheel.addRegion("likely", 400.0);
+    wheel.addRegion("rare", 0.0);
+    wheel.addRegion("negligible", -400.0);
+
+    EXPECT_NEAR(wheel.getLogNormalizer(), 400.0, 1e-9);
+    EXPECT_NEAR(wheel.getLogProbability("rare"), -400.0, 1e-9);
+    EXPECT_NEAR(wheel.getLogProbability("negligible"), -800.0, 1e-9);
+    EXPECT_EQ(wheel.getSelectionProbability("negligible"), 0.0);
+    for (int i = 0; i < 100; ++i) {
+        ASSERT_EQ(wheel.select(), "likely");
+    }
+
+    // Dropping the dominant region moves the shift down, so the rest become exact again
+    wheel.setLogWeight("likely", negativeInfinity);
+    EXPECT_NEAR(wheel.getSelectionProbability("rare"), 1.0, 1e-12);
+    wheel.removeElement("rare");
+    EXPECT_NEAR(wheel.getSelectionProbability("negligible"), 1.0, 1e-12);
+    EXPECT_EQ(wheel.select(), "negligible");
+}
+
+TEST_F(LogitRouletteWheelTest, RisingLogitsRebaseWithoutOverflow) {
+    wheel.addRegion("a", 0.0);
+    wheel.addRegion("b", 0.0);
+    for (int step = 1; step <= 100; ++step) {
+        wheel.setLogWeight("a", 10.0 * step);
+        wheel.setLogWeight("b", 10.0 * step - std::log(3.0));
+    }
+    EXPECT_NEAR(wheel.getSelectionProbability("a"), 0.75, 1e-9);
+    EXPECT_NEAR(wheel.getLogNormalizer(), 1000.0 + std::log(4.0 / 3.0), 1e-9);
+}
+
+TEST_F(LogitRouletteWheelTest, ExcludedRegionsAreNeverSelected) {
+    wheel.addRegion("a", 0.0);
+    wheel.addRegion("b", 5.0);
+    wheel.setLogWeight("b", negativeInfinity);
+
+    for (int i = 0; i < 1000; ++i) {
+        ASSERT_EQ(wheel.select(), "a");
+        ASSERT_EQ(wheel.selectGumbel(), "a");
+    }
+
+    wheel.setLogWeight("a", negativeInfinity);
+    EXPECT_THROW(wheel.select(), std::runtime_error);
+    EXPECT_THROW(wheel.selectGumbel(), std::runtime_error);
+
+    // Recovering from an all-excluded wheel picks up the new region's scale
+    wheel.setLogWeight("a", -900.0);
+    EXPECT_EQ(wheel.select(), "a");
+}
+
+// Gumbel-max and Batch Tests
+TEST_F(LogitRouletteWheelTest, GumbelMaxMatchesSoftmax) {
+    wheel.addRegion("a", -700.0);
+    wheel.addRegion("b", -700.0 + std::log(4.0));
+
+    int aCount = 0;
+    const int iterations = 10000;
+    for (int i = 0; i < iterations; ++i) {
+        aCount += wheel.selectGumbel() == "a";
+    }
+    EXPECT_NEAR(aCount * 100.0 / iterations, 20.0, 2.0);
+}
+
+TEST_F(LogitRouletteWheelTest, SetLogWeightsReplacesTheWholePolicy) {
+    LogitRouletteWheel<int> policy;
+    for (int i = 0; i < 4; ++i) {
+        policy.addRegion(i, 0.0);
+    }
+
+    const std::vector<double> logits = {-500.0, -500.0 + std::log(2.0), negativeInfinity, -500.0};
+    policy.setLogWeights(logits.data(), logits.size());
+    EXPECT_NEAR(policy.getSelectionProbability(1), 0.5, 1e-12);
+    EXPECT_EQ(policy.getSelectionProbability(2), 0.0);
+
+    std::vector<int> draws;
+    policy.selectBatch(10000, std::back_inserter(draws));
+    ASSERT_EQ(draws.size(), 10000u);
+    std::vector<int> counts(4, 0);
+    for (int draw : draws) {
+        ++counts[draw];
+    }
+    EXPECT_EQ(counts[2], 0);
+    EXPECT_NEAR(counts[1] / 100.0, 50.0, 2.0);
+}
+
+TEST_F(LogitRouletteWheelTest, SmallAndSortedBatchesAgree) {
+    LogitRouletteWheel<int> policy;
+    for (int i = 0; i < 256; ++i) {
+        policy.addRegion(i, 0.0);
+    }
+    // Only the first and last regions are selectable, at odds of 1:3
+    std::vector<double> logits(256, negativeInfinity);
+    logits.front() = 0.0;
+    logits.back() = std::log(3.0);
+    policy.setLogWeights(logits.data(), logits.size());
+
+    std::vector<int> small;
+    for (int i = 0; i < 4000; ++i) {
+        policy.selectBatch(4, std::back_inserter(small));
+    }
+    std::vector<int> sorted;
+    policy.selectBatch(16000, std::back_inserter(sorted));
+
+    for (const auto& draws : {small, sorted}) {
+        ASSERT_EQ(draws.size(), 16000u);
+        EXPECT_EQ(std::count(draws.begin(), draws.end(), 0) + std::count(draws.begin(), draws.end(), 255), 16000);
+        EXPECT_NEAR(std::count(draws.begin(), draws.end(), 255) / 160.0, 75.0, 2.0);
+    }
+    // Sorted batches still come out in draw order
+    EXPECT_FALSE(std::is_sorted(sorted.begin(), sorted.end()));
+}
+
+TEST_F(LogitRouletteWheelTest, RemoveElementKeepsLookupsCorrect) {
+    LogitRouletteWheel<int> large;
+    for (int i = 0; i < 200; ++i) {
+        large.addRegion(i, 0.01 * i);
+    }
+    EXPECT_TRUE(large.removeElement(10));
+    EXPECT_TRUE(large.removeElement(199));
+    EXPECT_FALSE(large.removeElement(10));
+
+    EXPECT_EQ(large.size(), 198u);
+    EXPECT_DOUBLE_EQ(large.getLogWeight(198), 1.98);
+    EXPECT_EQ(large.getLogWeight(10), negativeInfinity);
+    for (int i = 0; i < 1000; ++i) {
+        const int selected = large.select();
+        ASSERT_NE(selected, 10);
+        ASSERT_NE(selected, 199);
+    }
+}
@@ -1,9 +1,68 @@
 #include "../RouletteWheel.hpp"
 #include <gtest/gtest.h>
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <memory_resource>
 #include <string>
 #include <unordered_map>
 #include <vector>
 
+// Element type that records how often it is copied, for move-semantics tests
+struct CopyCountedElement {
+    static inline int copies = 0;
+
+    std::string name;
+
+    explicit CopyCountedElement(std::string name) : name(std::move(name)) {}
+    CopyCountedElement(const CopyCountedElement& other) : name(other.name) { ++copies; }
+    CopyCountedElement(CopyCountedElement&&) noexcept = default;
+    CopyCountedElement& operator=(const CopyCountedElement& other) {
+        name = other.name;
+        ++copies;
+        return *this;
+    }
+    CopyCountedElement& operator=(CopyCountedElement&&) noexcept = default;
+
+    bool operator==(const CopyCountedElement& other) const {
+        return name == other.name;
+    }
+};
+
+// Element type whose moves may throw and whose copies can be made to fail, for rollback tests
+struct FragileElement {
+    static inline int copiesBeforeFailure = -1;
+
+    int id = 0;
+
+    FragileElement() = default;
+    FragileElement(int id) : id(id) {}
+    FragileElement(const FragileElement& other) : id(other.id) { countCopy(); }
+    FragileElement(FragileElement&& other) noexcept(false) : id(other.id) {}
+    FragileElement& operator=(const FragileElement& other) {
+        countCopy();
+        id = other.id;
+        return *this;
+    }
+    FragileElement& operator=(FragileElement&& other) noexcept(false) {
+        id = other.id;
+        return *this;
+    }
+
+    bool operator==(const FragileElement& other) const {
+        return id == other.id;
+    }
+
+    static void countCopy() {
+        if (copiesBeforeFailure == 0) {
+            throw std::runtime_error("copy failed");
+        }
+        if (copiesBeforeFailure > 0) {
+            --copiesBeforeFailure;
+        }
+    }
+};
+
 class RouletteWheelTest : public ::testing::Test {
 protected:
     void SetUp() override {
@@ -50,6 +109,129 @@ TEST_F(RouletteWheelTest, VectorOfTuplesConstructor) {
     EXPECT_EQ(wheel.size(), 3);
 }
 
+// Memory resource that counts the allocations routed through it
+class CountingMemoryResource : public std::pmr::memory_resource {
+public:
+    size_t allocations = 0;
+
+private:
+    void* do_allocate(size_t bytes, size_t alignment) override {
+        ++allocations;
+        return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+    }
+
+    void do_deallocate(void* pointer, size_t bytes, size_t alignment) override {
+        std::pmr::new_delete_resource()->deallocate(pointer, bytes, alignment);
+    }
+
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override {
+        return this == &other;
+    }
+};
+
+TEST_F(RouletteWheelTest, PmrWheelAllocatesFromResource) {
+    CountingMemoryResource resource;
+    PmrRouletteWheel<int, int> pmrWheel(&resource);
+
+    for (int i = 0; i < 20; ++i) {
+        pmrWheel.addRegion(i, i + 1);
+    }
+
+    EXPECT_GT(resource.allocations, 0u);
+    EXPECT_EQ(pmrWheel.getAllocator().resource(), &resource);
+    EXPECT_EQ(pmrWheel.size(), 20);
+}
+
+TEST_F(RouletteWheelTest, PmrWheelFromMapUsesArena) {
+    std::array<std::byte, 4096> buffer;
+    std::pmr::monotonic_buffer_resource arena(buffer.data(), buffer.size(),
+                                              std::pmr::null_memory_resource());
+    std::vector<std::tuple<int, int>> data = {{1, 1}, {2, 2}, {3, 3}};
+
+    PmrRouletteWheel<int, int> pmrWheel(data, {}, &arena);
+
+    EXPECT_EQ(pmrWheel.size(), 3);
+    const int result = pmrWheel.select();
+    EXPECT_TRUE(result >= 1 && result <= 3);
+}
+
+TEST_F(RouletteWheelTest, SmallScannedWheelsAllocateOnlyTheirRegions) {
+    CountingMemoryResource resource;
+    PmrRouletteWheel<int, int> pmrWheel(&resource);
+    pmrWheel.reserve(20);
+    for (int i = 0; i < 20; ++i) {
+        pmrWheel.addRegion(i, i + 1);
+    }
+    for (int i = 0; i < 1000; ++i) {
+        pmrWheel.select();
+    }
+    EXPECT_EQ(pmrWheel.indexOf(7), std::optional<size_t>(7));
+    EXPECT_EQ(resource.allocations, 1u);  // The region storage: no engine state
+
+    PmrRouletteWheel<int, int> treeWheel(PmrRouletteWheel<int, int>::Options{true, WheelStrategy::FenwickTree}, &resource);
+    treeWheel.addRegion(1, 1);
+    treeWheel.addRegion(2, 2);
+    treeWheel.select();
+    EXPECT_GT(resource.allocations, 2u);  // Its engine state comes from the same resource
+    EXPECT_LE(sizeof(RouletteWheel<int, int>), 128u);
+}
+
+TEST_F(RouletteWheelTest, LargeWheelsAllocateOnlyTheirRegionsByDefault) {
+    CountingMemoryResource resource;
+    // Pinned to scanning so the adaptive usage history is not allocated either
+    PmrRouletteWheel<int, int> pmrWheel(PmrRouletteWheel<int, int>::Options{true, WheelStrategy::LinearScan}, &resource);
+    pmrWheel.reserve(512);
+    for (int i = 0; i < 512; ++i) {
+        pmrWheel.addRegion(i, i + 1);
+    }
+    EXPECT_EQ(pmrWheel.indexOf(300), std::optional<size_t>(300));
+    EXPECT_EQ(resource.allocations, 1u);  // No element index unless Options::indexElements
+}
+
+TEST_F(RouletteWheelTest, IndexedWheelsAllocateOneTable) {
+    CountingMemoryResource resource;
+    PmrRouletteWheel<int, int>::Options options;
+    options.strategy = WheelStrategy::LinearScan;
+    options.indexElements = true;
+    PmrRouletteWheel<int, int> pmrWheel(options, &resource);
+    pmrWheel.reserve(512);
+    for (int i = 0; i < 512; ++i) {
+        pmrWheel.addRegion(i, i + 1);
+    }
+    EXPECT_EQ(pmrWheel.indexOf(300), std::optional<size_t>(300));
+    EXPECT_EQ(pmrWheel.indexOf(512), std::nullopt);
+    EXPECT_EQ(resource.allocations, 2u);  // The regions and the index slots
+}
+
+TEST_F(RouletteWheelTest, IndexedWheelsTrackRemovalsAndBatches) {
+    for (WheelStrategy strategy : {WheelStrategy::Automatic, WheelStrategy::PowerOfTwoBuckets}) {
+        RouletteWheel<std::string, int>::Options options;
+        options.strategy = strategy;
+        options.indexElements = true;
+        RouletteWheel<std::string, int> indexed(options);
+        for (int i = 0; i < 200; ++i) {
+            indexed.addRegion("item" + std::to_string(i), i + 1);
+        }
+        indexed.indexOf("item0");  // Builds the index
+        for (int i = 0; i < 200; i += 7) {
+            EXPECT_TRUE(indexed.removeElement("item" + std::to_string(i)));
+        }
+        indexed.edit([](auto& tx) {
+            tx.removeElement("item1");
+            tx.addRegion("extra", 3);
+        });
+        indexed.addRegion("item2", 5);
+
+        const auto& regions = indexed.getRegions();
+        for (size_t i = 0; i < regions.size(); ++i) {
+            EXPECT_EQ(indexed.indexOf(regions[i].getElement()), std::optional<size_t>(i));
+        }
+        EXPECT_EQ(indexed.indexOf("item7"), std::nullopt);
+        EXPECT_EQ(indexed.indexOf("item1"), std::nullopt);
+        EXPECT_EQ(regions[*indexed.indexOf("item2")].getWeight(), 8);
+    }
+}
+
 // Add Region Tests
 TEST_F(RouletteWheelTest, AddSingleRegion) {
     wheel.addRegion("test", 10);
@@ -81,6 +263,54 @@ TEST_F(RouletteWheelTest, AddRegionThrowsOnNegativeWeight) {
     EXPECT_THROW(wheel.addRegion("invalid", -5), std::invalid_argument);
 }
 
+// Move-aware Insertion Tests
+TEST_F(RouletteWheelTest, AddRegionRvalueDoesNotCopy) {
+    RouletteWheel<CopyCountedElement, int> moveWheel;
+    CopyCountedElement::copies = 0;
+
+    moveWheel.addRegion(CopyCountedElement("sword"), 5);
+    moveWheel.addRegion(CopyCountedElement("shield"), 5);
+
+    EXPECT_EQ(CopyCountedElement::copies, 0);
+    EXPECT_EQ(moveWheel.size(), 2);
+}
+
+TEST_F(RouletteWheelTest, AddRegionRvalueCombinesWeights) {
+    std::string item = "item";
+    wheel.addRegion(std::string("item"), 5);
+    wheel.addRegion(std::move(item), 3);
+
+    EXPECT_EQ(wheel.size(), 1);
+    EXPECT_EQ(wheel.getRegions()[0].getWeight(), 8);
+}
+
+TEST_F(RouletteWheelTest, EmplaceRegionConstructsInPlace) {
+    RouletteWheel<CopyCountedElement, int> moveWheel;
+    CopyCountedElement::copies = 0;
+
+    moveWheel.emplaceRegion(4, "potion");
+    moveWheel.emplaceRegion(6, "elixir");
+
+    EXPECT_EQ(CopyCountedElement::copies, 0);
+    EXPECT_EQ(moveWheel.size(), 2);
+    EXPECT_EQ(moveWheel.getRegions()[0].getElement().name, "potion");
+}
+
+TEST_F(RouletteWheelTest, EmplaceRegionCombinesWeights) {
+    wheel.emplaceRegion(5, "item");
+    wheel.emplaceRegion(3, 4, 'x');
+    wheel.emplaceRegion(2, "item");
+
+    EXPECT_EQ(wheel.size(), 2);
+    EXPECT_EQ(wheel.getRegions()[0].getWeight(), 7);
+    EXPECT_EQ(wheel.getRegions()[1].getElement(), "xxxx");
+}
+
+TEST_F(RouletteWheelTest, EmplaceRegionThrowsOnZeroWeight) {
+    EXPECT_THROW(wheel.emplaceRegion(0, "invalid"), std::invalid_argument);
+    EXPECT_TRUE(wheel.empty());
+}
+
 // Selection Tests
 TEST_F(RouletteWheelTest, SelectThrowsOnEmptyWheel) {
     EXPECT_THROW(wheel.select(), std::runtime_error);
@@ -135,6 +365,553 @@ TEST_F(RouletteWheelTest, SelectDistribution) {
     EXPECT_NEAR(rarePercent, 10.0, 2.0);
 }
 
+// Uniform Weight Fast Path Tests
+TEST_F(RouletteWheelTest, UniformWeightsSelectEvenly) {
+    RouletteWheel<int, double> uniformWheel;
+    for (int i = 0; i < 4; ++i) {
+        uniformWheel.addRegion(i, 2.5);
+    }
+
+    std::vector<int> counts(4, 0);
+    const int iterations = 20000;
+    for (int i = 0; i < iterations; ++i) {
+        counts[uniformWheel.select()]++;
+    }
+
+    for (int count : counts) {
+        EXPECT_NEAR(count * 100.0 / iterations, 25.0, 2.0);
+    }
+}
+
+TEST_F(RouletteWheelTest, UniformFastPathFallsBackOnAppend) {
+    RouletteWheel<int, int> uniformWheel;
+    uniformWheel.addRegion(0, 1);
+    uniformWheel.addRegion(1, 1);
+    uniformWheel.select();  // Caches the totals while the weights are still uniform
+
+    uniformWheel.addRegion(2, 98);
+
+    int heavyCount = 0;
+    const int iterations = 10000;
+    for (int i = 0; i < iterations; ++i) {
+        if (uniformWheel.select() == 2) {
+            ++heavyCount;
+        }
+    }
+
+    EXPECT_NEAR(heavyCount * 100.0 / iterations, 98.0, 1.0);
+}
+
+TEST_F(RouletteWheelTest, UniformFastPathFallsBackOnWeightChange) {
+    RouletteWheel<int, float> uniformWheel;
+    uniformWheel.addRegion(0, 1.0f);
+    uniformWheel.addRegion(1, 1.0f);
+    uniformWheel.select();
+
+    uniformWheel.addRegion(1, 8.0f);  // Combines into an existing region
+
+    int heavyCount = 0;
+    const int iterations = 10000;
+    for (int i = 0; i < iterations; ++i) {
+        if (uniformWheel.select() == 1) {
+            ++heavyCount;
+        }
+    }
+
+    EXPECT_NEAR(heavyCount * 100.0 / iterations, 90.0, 2.0);
+}
+
+// Selection Strategy Tests
+const std::array<WheelStrategy, 5> pinnedStrategies = {
+    WheelStrategy::LinearScan, WheelStrategy::PrefixSum, WheelStrategy::AliasTable, WheelStrategy::FenwickTree,
+    WheelStrategy::PowerOfTwoBuckets
+};
+
+TEST_F(RouletteWheelTest, PinnedStrategiesFollowWeights) {
+    for (const WheelStrategy strategy : pinnedStrategies) {
+        RouletteWheel<int, int> pinnedWheel(RouletteWheel<int, int>::Options{true, strategy});
+        pinnedWheel.addRegion(0, 60);
+        for (int i = 1; i < 40; ++i) {
+            pinnedWheel.addRegion(i, 1);
+        }
+
+        int heavyCount = 0;
+        const int iterations = 20000;
+        for (int i = 0; i < iterations; ++i) {
+            if (pinnedWheel.select() == 0) {
+                ++heavyCount;
+            }
+        }
+
+        EXPECT_EQ(pinnedWheel.getActiveStrategy(), strategy);
+        EXPECT_NEAR(heavyCount * 100.0 / iterations, 60.0 * 100.0 / 99.0, 2.0);
+    }
+}
+
+TEST_F(RouletteWheelTest, PinnedStrategiesStayCorrectAcrossEdits) {
+    for (const WheelStrategy strategy : pinnedStrategies) {
+        RouletteWheel<int, double> pinnedWheel(RouletteWheel<int, double>::Options{true, strategy});
+        for (int i = 0; i < 40; ++i) {
+            pinnedWheel.addRegion(i, 1.0);
+        }
+        pinnedWheel.select();  // Builds the engine's cache
+
+        pinnedWheel.addRegion(100, 60.0);  // Append
+        pinnedWheel.removeElement(5);      // Erase from the middle
+        pinnedWheel.addRegion(0, 9.0);     // Combine into an existing region
+
+        int heavyCount = 0;
+        const int iterations = 20000;
+        for (int i = 0; i < iterations; ++i) {
+            if (pinnedWheel.select() == 100) {
+                ++heavyCount;
+            }
+        }
+
+        EXPECT_NEAR(heavyCount * 100.0 / iterations, 60.0 * 100.0 / 108.0, 2.0);
+        EXPECT_NEAR(pinnedWheel.getSelectionProbability(100), 60.0 / 108.0, 1e-9);
+    }
+}
+
+TEST_F(RouletteWheelTest, AutomaticStrategyScansSmallWheels) {
+    RouletteWheel<int, int> smallWheel;
+    for (int i = 0; i < 10; ++i) {
+        smallWheel.addRegion(i, i + 1);
+    }
+    for (int i = 0; i < 1000; ++i) {
+        smallWheel.select();
+    }
+
+    EXPECT_EQ(smallWheel.getStrategy(), WheelStrategy::Automatic);
+    EXPECT_EQ(smallWheel.getActiveStrategy(), WheelStrategy::LinearScan);
+}
+
+TEST_F(RouletteWheelTest, AutomaticStrategyUsesAliasTableWhenReadHeavy) {
+    RouletteWheel<int, int> largeWheel;
+    for (int i = 0; i < 10000; ++i) {
+        largeWheel.addRegion(i, i % 7 + 1);
+    }
+    for (int i = 0; i < 2000; ++i) {
+        largeWheel.select();
+    }
+
+    EXPECT_EQ(largeWheel.getActiveStrategy(), WheelStrategy::AliasTable);
+}
+
+TEST_F(RouletteWheelTest, AutomaticStrategyUsesFenwickTreeWhenWriteHeavy) {
+    RouletteWheel<int, int> largeWheel;
+    for (int i = 0; i < 10000; ++i) {
+        largeWheel.addRegion(i, i % 7 + 1);
+    }
+    for (int i = 0; i < 2000; ++i) {
+        largeWheel.selectAndModifyWeight(1);
+    }
+
+    EXPECT_EQ(largeWheel.getActiveStrategy(), WheelStrategy::FenwickTree);
+    EXPECT_EQ(largeWheel.size(), 10000);
+}
+
+TEST_F(RouletteWheelTest, SetStrategyPinsAndUnpinsEngine) {
+    RouletteWheel<int, int> largeWheel;
+    for (int i = 0; i < 100; ++i) {
+        largeWheel.addRegion(i, 1);
+    }
+
+    largeWheel.setStrategy(WheelStrategy::PrefixSum);
+    for (int i = 0; i < 1000; ++i) {
+        largeWheel.selectAndModifyWeight(1);
+    }
+    EXPECT_EQ(largeWheel.getStrategy(), WheelStrategy::PrefixSum);
+    EXPECT_EQ(largeWheel.getActiveStrategy(), WheelStrategy::PrefixSum);
+
+    largeWheel.setStrategy(WheelStrategy::Automatic);
+    EXPECT_EQ(largeWheel.getStrategy(), WheelStrategy::Automatic);
+}
+
+TEST_F(RouletteWheelTest, ElementLookupsStayCorrectOnLargeWheels) {
+    RouletteWheel<int, int> largeWheel;
+    for (int i = 0; i < 200; ++i) {
+        largeWheel.addRegion(i, 1);
+    }
+
+    EXPECT_TRUE(largeWheel.removeElement(50));
+    largeWheel.addRegion(150, 1);  // Must combine, not append
+
+    EXPECT_EQ(largeWheel.size(), 199);
+    EXPECT_DOUBLE_EQ(largeWheel.getSelectionProbability(50), 0.0);
+    EXPECT_DOUBLE_EQ(largeWheel.getSelectionProbability(150), 2.0 / 200.0);
+    EXPECT_DOUBLE_EQ(largeWheel.getSelectionProbability(199), 1.0 / 200.0);
+}
+
+TEST_F(RouletteWheelTest, PowerOfTwoBucketsTrackWeightsAcrossScales) {
+    RouletteWheel<int, double> bucketWheel(RouletteWheel<int, double>::Options{true, WheelStrategy::PowerOfTwoBuckets});
+    for (int i = 0; i < 20; ++i) {
+        bucketWheel.addRegion(i, std::ldexp(1.0, i - 10));  // 2^-10 .. 2^9
+    }
+    bucketWheel.select();  // Builds the buckets
+
+    bucketWheel.addRegion(0, 2047.0 - std::ldexp(1.0, -10));  // Moves region 0 from 2^-10 to 2^11 - 1
+
+    const double totalWeight = 2047.0 + (1024.0 - std::ldexp(1.0, -9));
+    int movedCount = 0;
+    const int iterations = 20000;
+    for (int i = 0; i < iterations; ++i) {
+        if (bucketWheel.select() == 0) {
+            ++movedCount;
+        }
+    }
+
+    EXPECT_NEAR(movedCount * 100.0 / iterations, 2047.0 * 100.0 / totalWeight, 2.0);
+}
+
+TEST_F(RouletteWheelTest, PowerOfTwoBucketsRemoveBySwappingInTheLastRegion) {
+    RouletteWheel<int, double> bucketWheel(RouletteWheel<int, double>::Options{true, WheelStrategy::PowerOfTwoBuckets});
+    for (int i = 0; i < 200; ++i) {
+        bucketWheel.addRegion(i, std::ldexp(1.0, i % 8));
+    }
+    bucketWheel.select();  // Builds the buckets
+
+    EXPECT_TRUE(bucketWheel.removeElement(3));
+    EXPECT_EQ(bucketWheel.getRegions()[3].getElement(), 199);  // The last region filled the gap
+    EXPECT_EQ(bucketWheel.indexOf(199), std::optional<size_t>(3));
+    bucketWheel.adjustWeight(10, -std::ldexp(1.0, 2));  // Drops to zero: removed the same way
+    for (int i = 0; i < 150; ++i) {
+        bucketWheel.selectAndRemove();
+    }
+    bucketWheel.addRegion(1000, 1024.0);
+
+    double totalWeight = 0.0;
+    for (const auto& region : bucketWheel.getRegions()) {
+        totalWeight += region.getWeight();
+    }
+    int heavyCount = 0;
+    const int iterations = 20000;
+    for (int i = 0; i < iterations; ++i) {
+        heavyCount += bucketWheel.select() == 1000;
+    }
+    EXPECT_EQ(bucketWheel.size(), 49);
+    EXPECT_NEAR(heavyCount * 100.0 / iterations, 1024.0 * 100.0 / totalWeight, 2.0);
+    EXPECT_NEAR(bucketWheel.getSelectionProbability(1000), 1024.0 / totalWeight, 1e-9);
+}
+
+TEST_F(RouletteWheelTest, StochasticAcceptanceFollowsWeights) {
+    RouletteWheel<int, int> acceptanceWheel(RouletteWheel<int, int>::Options{true, WheelStrategy::StochasticAcceptance});
+    for (int i = 0; i < 10; ++i) {
+        acceptanceWheel.addRegion(i, i + 1);
+    }
+
+    int heaviestCount = 0;
+    const int iterations = 20000;
+    for (int i = 0; i < iterations; ++i) {
+        if (acceptanceWheel.select() == 9) {
+            ++heaviestCount;
+        }
+    }
+
+    EXPECT_EQ(acceptanceWheel.getActiveStrategy(), WheelStrategy::StochasticAcceptance);
+    EXPECT_NEAR(heaviestCount * 100.0 / iterations, 10.0 * 100.0 / 55.0, 2.0);
+}
+
+TEST_F(RouletteWheelTest, StochasticAcceptanceSurvivesMaxRegionRemoval) {
+    RouletteWheel<int, double> acceptanceWheel(RouletteWheel<int, double>::Options{true, WheelStrategy::StochasticAcceptance});
+    acceptanceWheel.addRegion(0, 8.0);
+    acceptanceWheel.addRegion(1, 1.0);
+    acceptanceWheel.addRegion(2, 3.0);
+    acceptanceWheel.select();  // Computes the max weight
+
+    acceptanceWheel.removeElement(0);  // The max weight becomes a loose bound
+
+    int heavyCount = 0;
+    const int iterations = 20000;
+    for (int i = 0; i < iterations; ++i) {
+        if (acceptanceWheel.select() == 2) {
+            ++heavyCount;
+        }
+    }
+
+    EXPECT_NEAR(heavyCount * 100.0 / iterations, 75.0, 2.0);
+}
+
+TEST_F(RouletteWheelTest, StochasticAcceptanceFallsBackWhenSkewed) {
+    RouletteWheel<int, int> acceptanceWheel(RouletteWheel<int, int>::Options{true, WheelStrategy::StochasticAcceptance});
+    for (int i = 0; i < 1000; ++i) {
+        acceptanceWheel.addRegion(i, 1);
+    }
+    acceptanceWheel.addRegion(1000, 9000);
+
+    int heavyCount = 0;
+    const int iterations = 5000;
+    for (int i = 0; i < iterations; ++i) {
+        if (acceptanceWheel.select() == 1000) {
+            ++heavyCount;
+        }
+    }
+
+    EXPECT_EQ(acceptanceWheel.getStrategy(), WheelStrategy::StochasticAcceptance);
+    EXPECT_EQ(acceptanceWheel.getActiveStrategy(), WheelStrategy::FenwickTree);
+    EXPECT_NEAR(heavyCount * 100.0 / iterations, 90.0, 2.0);
+
+    // Once the skew is gone the wheel returns to rejection sampling
+    acceptanceWheel.removeElement(1000);
+    for (int i = 0; i < 200; ++i) {
+        acceptanceWheel.select();
+    }
+    EXPECT_EQ(acceptanceWheel.getActiveStrategy(), WheelStrategy::StochasticAcceptance);
+}
+
+// Masked Selection Tests
+TEST_F(RouletteWheelTest, MaskedSelectSkipsDisabledRegions) {
+    wheel.addRegion("attack", 50);
+    wheel.addRegion("defend", 30);
+    wheel.addRegion("heal", 15);
+    wheel.addRegion("special", 5);
+    const std::vector<bool> enabled = {true, true, false, true};
+
+    int attackCount = 0;
+    const int iterations = 10000;
+    for (int i = 0; i < iterations; ++i) {
+        const std::string action = wheel.select(enabled);
+        ASSERT_NE(action, "heal");
+        attackCount += action == "attack";
+    }
+
+    // Remaining weights renormalise: 50 / 85
+    EXPECT_NEAR(attackCount * 100.0 / iterations, 50.0 / 85.0 * 100.0, 2.0);
+    EXPECT_EQ(wheel.size(), 4);
+}
+
+TEST_F(RouletteWheelTest, MaskedSelectValidatesMask) {
+    EXPECT_THROW(wheel.select(std::vector<bool>{}), std::runtime_error);
+
+    wheel.addRegion("a", 1);
+    wheel.addRegion("b", 1);
+    EXPECT_THROW(wheel.select(std::vector<bool>{true}), std::invalid_argument);
+    EXPECT_THROW(wheel.select(std::vector<bool>{false, false}), std::runtime_error);
+    EXPECT_THROW(wheel.selectIf([](const std::string&) { return false; }), std::runtime_error);
+}
+
+TEST_F(RouletteWheelTest, SelectIfFiltersByElement) {
+    wheel.addRegion("attack", 50);
+    wheel.addRegion("heal", 45);
+    wheel.addRegion("special", 5);
+
+    for (int i = 0; i < 200; ++i) {
+        EXPECT_EQ(wheel.selectIf([](const std::string& action) { return action == "special"; }), "special");
+    }
+}
+
+TEST_F(RouletteWheelTest, SparseMasksFollowWeightsUnderEveryEngine) {
+    const int numElements = 200;
+    for (const WheelStrategy strategy : pinnedStrategies) {
+        RouletteWheel<int, int> pinnedWheel(RouletteWheel<int, int>::Options{true, strategy});
+        for (int i = 0; i < numElements; ++i) {
+            pinnedWheel.addRegion(i, i % 2 == 0 ? 3 : 1);
+        }
+
+        // Exclude a handful of regions, including the first and last
+        std::vector<bool> enabled(numElements, true);
+        for (const int excluded : {0, 1, 2, 57, 100, 198, 199}) {
+            enabled[excluded] = false;
+        }
+
+        int evenCount = 0;
+        const int iterations = 20000;
+        for (int i = 0; i < iterations; ++i) {
+            const int selected = pinnedWheel.select(enabled);
+            ASSERT_TRUE(enabled[selected]) << "strategy " << static_cast<int>(strategy);
+            evenCount += selected % 2 == 0;
+        }
+
+        // 96 even regions of weight 3 against 97 odd regions of weight 1
+        EXPECT_NEAR(evenCount * 100.0 / iterations, 288.0 / 385.0 * 100.0, 2.0)
+            << "strategy " << static_cast<int>(strategy);
+    }
+}
+
+TEST_F(RouletteWheelTest, SelectExcludingSkipsListedIndices) {
+    RouletteWheel<int, int> largeWheel;
+    for (int i = 0; i < 100; ++i) {
+        largeWheel.addRegion(i, 1);
+    }
+    EXPECT_THROW(largeWheel.selectExcluding({100}), std::out_of_range);
+
+    // Unsorted, duplicated and long exclusion lists are all accepted
+    std::vector<size_t> excluded = {99, 3, 3, 0, 50};
+    for (size_t i = 60; i < 95; ++i) {
+        excluded.push_back(i);
+    }
+    for (int i = 0; i < 2000; ++i) {
+        const size_t selected = static_cast<size_t>(largeWheel.selectExcluding(excluded));
+        ASSERT_EQ(std::find(excluded.begin(), excluded.end(), selected), excluded.end());
+    }
+}
+
+TEST_F(RouletteWheelTest, SparseMasksStayCorrectAcrossEdits) {
+    RouletteWheel<int, double> editedWheel(RouletteWheel<int, double>::Options{true, WheelStrategy::FenwickTree});
+    for (int i = 0; i < 100; ++i) {
+        editedWheel.addRegion(i, 1.0);
+    }
+    std::vector<bool> enabled(100, true);
+    enabled[10] = false;
+
+    // Make the excluded region overwhelmingly heavy; the mask must still hold
+    editedWheel.addRegion(10, 1e6);
+    editedWheel.addRegion(100, 2.5);
+    enabled.push_back(true);
+    for (int i = 0; i < 1000; ++i) {
+        ASSERT_NE(editedWheel.select(enabled), 10);
+    }
+}
+
+// Weight Transform Tests
+TEST_F(RouletteWheelTest, ScaleWeightsAppliesToExistingWeightsOnly) {
+    RouletteWheel<std::string, double> scaledWheel;
+    scaledWheel.addRegion("a", 1.0);
+    scaledWheel.addRegion("b", 1.0);
+
+    scaledWheel.scaleWeights(3.0);
+    EXPECT_DOUBLE_EQ(scaledWheel.getSelectionProbability("a"), 0.5);
+    EXPECT_DOUBLE_EQ(scaledWheel.getWeightScale(), 3.0);
+
+    // New weights are in scaled units, so they compete with a and b at 3 each
+    scaledWheel.addRegion("c", 2.0);
+    EXPECT_DOUBLE_EQ(scaledWheel.getSelectionProbability("c"), 0.25);
+    EXPECT_DOUBLE_EQ(scaledWheel.getRegions()[2].getWeight(), 2.0 / 3.0);
+    EXPECT_THROW(scaledWheel.scaleWeights(0.0), std::invalid_argument);
+}
+
+TEST_F(RouletteWheelTest, ScaleWeightsFoldsExtremeScales) {
+    RouletteWheel<int, double> scaledWheel;
+    scaledWheel.addRegion(0, 1.0);
+    scaledWheel.addRegion(1, 3.0);
+
+    for (int tick = 0; tick < 100; ++tick) {
+        scaledWheel.scaleWeights(1.5);
+    }
+    EXPECT_LT(scaledWheel.getWeightScale(), 4294967296.0);
+    EXPECT_NEAR(scaledWheel.getSelectionProbability(1), 0.75, 1e-12);
+
+    scaledWheel.addRegion(2, 1.0);
+    EXPECT_LT(scaledWheel.getSelectionProbability(2), 1e-12);
+}
+
+TEST_F(RouletteWheelTest, TemperatureReshapesDistribution) {
+    wheel.addRegion("low", 1);
+    wheel.addRegion("high", 3);
+
+    wheel.setTemperature(0.5);  // Weights become 1 and 9
+    EXPECT_DOUBLE_EQ(wheel.getSelectionProbability("high"), 0.9);
+
+    int highCount = 0;
+    const int iterations = 10000;
+    for (int i = 0; i < iterations; ++i) {
+        highCount += wheel.select() == "high";
+    }
+    EXPECT_NEAR(highCount * 100.0 / iterations, 90.0, 2.0);
+
+    // Appends extend the cached effective weights
+    wheel.addRegion("third", 2);
+    EXPECT_DOUBLE_EQ(wheel.getSelectionProbability("third"), 4.0 / 14.0);
+
+    wheel.setTemperature(1.0);
+    EXPECT_DOUBLE_EQ(wheel.getSelectionProbability("high"), 0.5);
+    EXPECT_THROW(wheel.setTemperature(-1.0), std::invalid_argument);
+}
+
+TEST_F(RouletteWheelTest, WeightOffsetShiftsEveryWeight) {
+    wheel.addRegion("a", 1);
+    wheel.addRegion("b", 3);
+
+    wheel.setWeightOffset(1.0);
+    EXPECT_DOUBLE_EQ(wheel.getSelectionProbability("a"), 1.0 / 3.0);
+
+    // Regions pushed to zero or below are never selected
+    wheel.setWeightOffset(-1.0);
+    EXPECT_DOUBLE_EQ(wheel.getSelectionProbability("a"), 0.0);
+    for (int i = 0; i < 100; ++i) {
+        EXPECT_EQ(wheel.select(), "b");
+        EXPECT_EQ(wheel.select(std::vector<bool>{true, true}), "b");
+    }
+    EXPECT_THROW(wheel.select(std::vector<bool>{true, false}), std::runtime_error);
+
+    wheel.setWeightOffset(-5.0);
+    EXPECT_THROW(wheel.select(), std::runtime_error);
+}
+
+// Set Weight Tests
+TEST_F(RouletteWheelTest, SetWeightReplacesWeightByElementAndIndex) {
+    wheel.addRegion("a", 5);
+    wheel.addRegion("b", 10);
+
+    EXPECT_TRUE(wheel.setWeight("a", 30));
+    EXPECT_FALSE(wheel.setWeight("missing", 1));
+    wheel.setWeightAt(1, 20);
+
+    EXPECT_EQ(wheel.getRegions()[0].getWeight(), 30);
+    EXPECT_DOUBLE_EQ(wheel.getSelectionProbability("a"), 0.6);
+    EXPECT_THROW(wheel.setWeight("a", 0), std::invalid_argument);
+    EXPECT_THROW(wheel.setWeightAt(2, 1), std::out_of_range);
+}
+
+TEST_F(RouletteWheelTest, AdjustWeightRemovesRegionsThatDropToZero) {
+    wheel.addRegion("a", 5);
+    wheel.addRegion("b", 10);
+    wheel.addRegion("c", 15);
+
+    EXPECT_TRUE(wheel.adjustWeight("a", 3));
+    EXPECT_TRUE(wheel.adjustWeight("b", -10));
+    EXPECT_FALSE(wheel.adjustWeight("b", 1));
+    wheel.adjustWeightAt(1, -5);
+
+    ASSERT_EQ(wheel.size(), 2);
+    EXPECT_EQ(wheel.getRegions()[0].getWeight(), 8);
+    EXPECT_EQ(wheel.getRegions()[1].getWeight(), 10);
+    EXPECT_THROW(wheel.adjustWeightAt(2, 1), std::out_of_range);
+}
+
+TEST_F(RouletteWheelTest, SetWeightKeepsEveryEngineInSync) {
+    for (const WheelStrategy strategy : pinnedStrategies) {
+        RouletteWheel<int, double> pinnedWheel(RouletteWheel<int, double>::Options{true, strategy});
+        for (int i = 0; i < 100; ++i) {
+            pinnedWheel.addRegion(i, 1.0);
+        }
+        pinnedWheel.select();  // Builds the engine's cache
+
+        for (int round = 0; round < 50; ++round) {
+            pinnedWheel.setWeight(round % 10, 1.0 + round);
+            pinnedWheel.select();
+        }
+        pinnedWheel.setWeight(7, 51.0);
+        pinnedWheel.adjustWeight(8, -49.0);  // Last set to 49, so the region is removed
+        pinnedWheel.setWeightAt(0, 0.5);
+
+        double total = 0.0;
+        for (const auto& region : pinnedWheel.getRegions()) {
+            total += region.getWeight();
+        }
+        int sevenCount = 0;
+        const int iterations = 20000;
+        for (int i = 0; i < iterations; ++i) {
+            sevenCount += pinnedWheel.select() == 7;
+        }
+        EXPECT_NEAR(sevenCount * 100.0 / iterations, 51.0 * 100.0 / total, 2.0);
+        EXPECT_NEAR(pinnedWheel.getSelectionProbability(7), 51.0 / total, 1e-9);
+        EXPECT_FALSE(pinnedWheel.indexOf(8).has_value());
+    }
+}
+
+TEST_F(RouletteWheelTest, SetWeightUsesScaledUnits) {
+    RouletteWheel<std::string, double> scaledWheel;
+    scaledWheel.addRegion("a", 1.0);
+    scaledWheel.addRegion("b", 1.0);
+    scaledWheel.scaleWeights(4.0);
+
+    scaledWheel.setWeight("a", 12.0);  // Three times b's scaled weight of 4
+    EXPECT_DOUBLE_EQ(scaledWheel.getSelectionProbability("a"), 0.75);
+    scaledWheel.adjustWeight("b", 4.0);
+    EXPECT_DOUBLE_EQ(scaledWheel.getSelectionProbability("a"), 0.6);
+}
+
 // Select and Modify Weight Tests
 TEST_F(RouletteWheelTest, SelectAndModifyWeightDecreasesWeight) {
     wheel.addRegion("item", 10);
@@ -188,6 +965,30 @@ TEST_F(RouletteWheelTest, SelectAndRemoveMultipleElements) {
     EXPECT_TRUE(wheel.empty());
 }
 
+TEST_F(RouletteWheelTest, SelectAndRemoveMovesElementOut) {
+    RouletteWheel<CopyCountedElement, int> moveWheel;
+    moveWheel.emplaceRegion(1, "a");
+    moveWheel.emplaceRegion(1, "b");
+    CopyCountedElement::copies = 0;
+
+    CopyCountedElement first = moveWheel.selectAndRemove();
+    CopyCountedElement second = moveWheel.selectAndRemove();
+
+    EXPECT_EQ(CopyCountedElement::copies, 0);
+    EXPECT_NE(first.name, second.name);
+    EXPECT_TRUE(moveWheel.empty());
+}
+
+TEST_F(RouletteWheelTest, SelectAndRemoveSafeReturnsNulloptOnEmptyWheel) {
+    EXPECT_FALSE(wheel.selectAndRemoveSafe().has_value());
+
+    wheel.addRegion("only", 3);
+    auto result = wheel.selectAndRemoveSafe();
+    ASSERT_TRUE(result.has_value());
+    EXPECT_EQ(*result, "only");
+    EXPECT_TRUE(wheel.empty());
+}
+
 // Remove Element Tests
 TEST_F(RouletteWheelTest, RemoveElementExisting) {
     wheel.addRegion("item", 10);
@@ -216,6 +1017,135 @@ TEST_F(RouletteWheelTest, RemoveInvalidRegionsNoneInvalid) {
     EXPECT_EQ(wheel.size(), 2);
 }
 
+// Batch Edit Tests
+TEST_F(RouletteWheelTest, EditAppliesAddsRemovalsAndWeightSets) {
+    wheel.addRegion("a", 5);
+    wheel.addRegion("b", 10);
+    wheel.addRegion("c", 15);
+
+    wheel.edit([](auto& tx) {
+        EXPECT_TRUE(tx.removeElement("a"));
+        EXPECT_FALSE(tx.removeElement("a"));
+        EXPECT_TRUE(tx.setWeight("b", 20));
+        EXPECT_FALSE(tx.setWeight("missing", 1));
+        tx.addRegion("c", 5);   // Combines
+        tx.addRegion("d", 10);  // Appends
+    });
+
+    ASSERT_EQ(wheel.size(), 3);
+    EXPECT_EQ(wheel.getRegions()[0].getElement(), "b");
+    EXPECT_EQ(wheel.getRegions()[2].getElement(), "d");
+    EXPECT_DOUBLE_EQ(wheel.getSelectionProbability("a"), 0.0);
+    EXPECT_DOUBLE_EQ(wheel.getSelectionProbability("b"), 0.4);
+    EXPECT_DOUBLE_EQ(wheel.getSelectionProbability("c"), 0.4);
+    EXPECT_EQ(wheel.indexOf("d"), std::optional<size_t>(2));
+}
+
+TEST_F(RouletteWheelTest, EditRestoresAnElementRemovedEarlierInTheBatch) {
+    wheel.addRegion("a", 5);
+    wheel.addRegion("b", 10);
+
+    wheel.edit([](auto& tx) {
+        tx.removeElement("a");
+        tx.addRegion("a", 2);
+        EXPECT_THROW(tx.addRegion("c", 0), std::invalid_argument);
+    });
+
+    ASSERT_EQ(wheel.size(), 2);
+    EXPECT_EQ(wheel.getRegions()[0].getWeight(), 2);
+}
+
+TEST_F(RouletteWheelTest, EditRollsBackWhenTheCallableThrows) {
+    for (const WheelStrategy strategy : pinnedStrategies) {
+        RouletteWheel<int, double> pinnedWheel(RouletteWheel<int, double>::Options{true, strategy});
+        for (int i = 0; i < 100; ++i) {
+            pinnedWheel.addRegion(i, 1.0 + i % 3);
+        }
+        pinnedWheel.select();  // Builds the engine's cache
+        const double probability = pinnedWheel.getSelectionProbability(7);
+
+        EXPECT_THROW(pinnedWheel.edit([](auto& tx) {
+            tx.removeElement(7);
+            tx.setWeight(8, 50.0);
+            tx.addRegion(9, 5.0);
+            tx.setWeight(9, 1.0);
+            for (int i = 100; i < 150; ++i) {
+                tx.addRegion(i, 1.0);
+            }
+            throw std::runtime_error("abort");
+        }), std::runtime_error);
+
+        ASSERT_EQ(pinnedWheel.size(), 100);
+        EXPECT_DOUBLE_EQ(pinnedWheel.getRegions()[8].getWeight(), 3.0);
+        EXPECT_DOUBLE_EQ(pinnedWheel.getRegions()[9].getWeight(), 1.0);
+        EXPECT_DOUBLE_EQ(pinnedWheel.getSelectionProbability(7), probability);
+        EXPECT_FALSE(pinnedWheel.indexOf(120).has_value());
+        for (int i = 0; i < 1000; ++i) {
+            EXPECT_LT(pinnedWheel.select(), 100);
+        }
+    }
+}
+
+TEST_F(RouletteWheelTest, EditRollsBackWhenApplyingRemovalsThrows) {
+    RouletteWheel<FragileElement, double> fragile;
+    for (int i = 0; i < 10; ++i) {
+        fragile.addRegion(i, 1.0);
+    }
+
+    EXPECT_THROW(fragile.edit([](auto& tx) {
+        tx.removeElement(2);
+        tx.setWeight(5, 9.0);
+        tx.addRegion(100, 1.0);
+        // Commit copies the kept regions (their moves may throw); fail part way through
+        FragileElement::copiesBeforeFailure = 4;
+    }), std::runtime_error);
+    FragileElement::copiesBeforeFailure = -1;
+
+    ASSERT_EQ(fragile.size(), 10);
+    for (int i = 0; i < 10; ++i) {
+        EXPECT_EQ(fragile.getRegions()[i].getElement().id, i);
+        EXPECT_DOUBLE_EQ(fragile.getRegions()[i].getWeight(), 1.0);
+    }
+    EXPECT_FALSE(fragile.indexOf(100).has_value());
+
+    fragile.edit([](auto& tx) {
+        tx.removeElement(2);
+        tx.addRegion(100, 1.0);
+    });
+    ASSERT_EQ(fragile.size(), 10);
+    EXPECT_EQ(fragile.getRegions()[2].getElement().id, 3);
+    EXPECT_EQ(fragile.indexOf(100), std::optional<size_t>(9));
+}
+
+TEST_F(RouletteWheelTest, EditedWheelsFollowTheNewWeightsUnderEveryEngine) {
+    for (const WheelStrategy strategy : pinnedStrategies) {
+        RouletteWheel<int, double> pinnedWheel(RouletteWheel<int, double>::Options{true, strategy});
+        for (int i = 0; i < 100; ++i) {
+            pinnedWheel.addRegion(i, 1.0);
+        }
+        pinnedWheel.select();
+
+        pinnedWheel.edit([](auto& tx) {
+            tx.reserve(1);
+            for (int i = 0; i < 100; i += 2) {
+                tx.removeElement(i);
+            }
+            tx.setWeight(1, 25.0);
+            tx.addRegion(200, 25.0);
+        });
+
+        int heavyCount = 0;
+        const int iterations = 20000;
+        for (int i = 0; i < iterations; ++i) {
+            const int selected = pinnedWheel.select();
+            EXPECT_TRUE(selected % 2 == 1 || selected == 200);
+            heavyCount += selected == 1 || selected == 200;
+        }
+        EXPECT_EQ(pinnedWheel.size(), 51);
+        EXPECT_NEAR(heavyCount * 100.0 / iterations, 50.0 * 100.0 / 99.0, 2.0);
+    }
+}
+
 // Query Tests
 TEST_F(RouletteWheelTest, EmptyReturnsTrue) {
     EXPECT_TRUE(wheel.empty());
@@ -253,6 +1183,49 @@ TEST_F(RouletteWheelTest, GetSelectionProbabilityEmptyWheel) {
     EXPECT_DOUBLE_EQ(wheel.getSelectionProbability("anything"), 0.0);
 }
 
+TEST_F(RouletteWheelTest, GetSelectionProbabilityAtMatchesElementLookups) {
+    RouletteWheel<int, double> largeWheel;
+    for (int i = 0; i < 500; ++i) {
+        largeWheel.addRegion(i, 1.0 + i % 9);
+    }
+    largeWheel.removeElement(17);
+
+    for (size_t i = 0; i < largeWheel.size(); ++i) {
+        const int element = largeWheel.getRegions()[i].getElement();
+        EXPECT_EQ(largeWheel.getSelectionProbabilityAt(i), largeWheel.getSelectionProbability(element));
+    }
+    EXPECT_THROW(largeWheel.getSelectionProbabilityAt(largeWheel.size()), std::out_of_range);
+}
+
+TEST_F(RouletteWheelTest, ProbabilitiesExportsEveryRegionInOrder) {
+    wheel.addRegion("a", 25);
+    wheel.addRegion("b", 25);
+    wheel.addRegion("c", 50);
+
+    const std::vector<double> probabilities = wheel.probabilities();
+    ASSERT_EQ(probabilities.size(), 3u);
+    EXPECT_DOUBLE_EQ(probabilities[0], 0.25);
+    EXPECT_DOUBLE_EQ(probabilities[2], 0.5);
+
+    std::array<double, 2> tooSmall{};
+    EXPECT_THROW(wheel.probabilities(tooSmall.data(), tooSmall.size()), std::invalid_argument);
+
+    RouletteWheel<std::string, int> emptyWheel;
+    EXPECT_TRUE(emptyWheel.probabilities().empty());
+}
+
+TEST_F(RouletteWheelTest, ProbabilitiesFollowWeightTransforms) {
+    RouletteWheel<std::string, double> transformedWheel;
+    transformedWheel.addRegion("a", 1.0);
+    transformedWheel.addRegion("b", 3.0);
+    transformedWheel.setTemperature(0.5);  // Squares the weights: 1 and 9
+
+    const std::vector<double> probabilities = transformedWheel.probabilities();
+    EXPECT_DOUBLE_EQ(probabilities[0], 0.1);
+    EXPECT_DOUBLE_EQ(probabilities[1], 0.9);
+    EXPECT_EQ(probabilities[1], transformedWheel.getSelectionProbability("b"));
+}
+
 TEST_F(RouletteWheelTest, GetRegionsReturnsCorrectData) {
     wheel.addRegion("a", 10);
     wheel.addRegion("b", 20);
@@ -342,3 +1315,141 @@ TEST_F(RouletteWheelTest, SeedRandomProducesConsistentResults) {
         EXPECT_EQ(wheel1.select(), wheel2.select());
     }
 }
+
+#ifdef USE_CEREAL
+// Serialization Tests
+
+#include <cereal/archives/binary.hpp>
+#include <cereal/types/string.hpp>
+#include <cereal/types/vector.hpp>
+#include <sstream>
+
+namespace {
+template<typename Wheel>
+std::string saveWheel(const Wheel& wheel) {
+    std::ostringstream stream;
+    {
+        cereal::BinaryOutputArchive archive(stream);
+        archive(wheel);
+    }
+    return stream.str();
+}
+
+template<typename Wheel>
+void loadWheel(const std::string& bytes, Wheel& wheel) {
+    std::istringstream stream(bytes);
+    cereal::BinaryInputArchive archive(stream);
+    archive(wheel);
+}
+}
+
+TEST_F(RouletteWheelTest, SerializationRoundTripsRegionsAndTransforms) {
+    RouletteWheel<std::string, double>::Options options;
+    options.serializeCaches = true;
+    RouletteWheel<std::string, double> wheel(options);
+    wheel.addRegion("a", 1.0);
+    wheel.addRegion("b", 3.0);
+    wheel.setTemperature(2.0);
+
+    RouletteWheel<std::string, double> loaded(options);
+    loadWheel(saveWheel(wheel), loaded);
+
+    EXPECT_EQ(loaded.size(), 2);
+    EXPECT_DOUBLE_EQ(loaded.getRegions()[1].getWeight(), 3.0);
+    EXPECT_DOUBLE_EQ(loaded.getTemperature(), 2.0);
+    EXPECT_DOUBLE_EQ(loaded.getSelectionProbability("b"), wheel.getSelectionProbability("b"));
+}
+
+TEST_F(RouletteWheelTest, SerializedCachesRestoreTheSavedEngine) {
+    using Wheel = RouletteWheel<int, double>;
+    Wheel::Options options;
+    options.strategy = Wheel::Strategy::AliasTable;
+    options.serializeCaches = true;
+    Wheel wheel(options);
+    for (int i = 0; i < 100; ++i) {
+        wheel.addRegion(i, 1.0 + i);
+    }
+
+    Wheel::Options loadOptions;
+    loadOptions.serializeCaches = true;
+    Wheel loaded(loadOptions);
+    loadWheel(saveWheel(wheel), loaded);
+
+    EXPECT_EQ(loaded.getActiveStrategy(), Wheel::Strategy::AliasTable);
+    EXPECT_DOUBLE_EQ(loaded.getSelectionProbability(99), wheel.getSelectionProbability(99));
+    loaded.seedRandom(7);
+    std::vector<int> counts(100, 0);
+    for (int i = 0; i < 20000; ++i) {
+        ++counts[loaded.select()];
+    }
+    EXPECT_GT(counts[99], counts[0]);
+}
+
+TEST_F(RouletteWheelTest, SerializedCachesAreRebuiltWhenTheWheelPinsAnotherEngine) {
+    using Wheel = RouletteWheel<int, int>;
+    Wheel::Options options;
+    options.strategy = Wheel::Strategy::PrefixSum;
+    options.serializeCaches = true;
+    Wheel wheel(options);
+    wheel.addRegion(1, 1);
+    wheel.addRegion(2, 9);
+
+    Wheel::Options pinned;
+    pinned.strategy = Wheel::Strategy::FenwickTree;
+    pinned.serializeCaches = true;
+    Wheel loaded(pinned);
+    loadWheel(saveWheel(wheel), loaded);
+
+    EXPECT_EQ(loaded.getActiveStrategy(), Wheel::Strategy::FenwickTree);
+    EXPECT_EQ(loaded.size(), 2);
+    EXPECT_DOUBLE_EQ(loaded.getSelectionProbability(2), 0.9);
+}
+
+TEST_F(RouletteWheelTest, ArchivesFromBeforeTheCacheBlockStillLoad) {
+    // A wheel of {"gold", 3} and {"iron", 1} as saved by the original serialize(), which
+    // archived only the regions: cereal's binary layout of a vector (64-bit size, then each
+    // region's string with its 64-bit size and its 32-bit weight)
+    const std::string baselineBytes(
+        "\x02\x00\x00\x00\x00\x00\x00\x00"
+        "\x04\x00\x00\x00\x00\x00\x00\x00" "gold" "\x03\x00\x00\x00"
+        "\x04\x00\x00\x00\x00\x00\x00\x00" "iron" "\x01\x00\x00\x00",
+        40);
+
+    RouletteWheel<std::string, int> loaded;
+    loadWheel(baselineBytes, loaded);
+
+    ASSERT_EQ(loaded.size(), 2);
+    EXPECT_EQ(loaded.getRegions()[0].getElement(), "gold");
+    EXPECT_DOUBLE_EQ(loaded.getSelectionProbability("gold"), 0.75);
+    // And a wheel without Options::serializeCaches writes exactly that layout
+    EXPECT_EQ(saveWheel(loaded), baselineBytes);
+}
+
+TEST_F(RouletteWheelTest, SavingTransformsRequiresTheCacheBlock) {
+    RouletteWheel<std::string, double> transformed;
+    transformed.addRegion("a", 1.0);
+    transformed.setTemperature(2.0);
+
+    EXPECT_THROW(saveWheel(transformed), std::runtime_error);
+}
+
+TEST_F(RouletteWheelTest, SerializedCachesWithAnUnknownEngineAreRebuilt) {
+    using Wheel = RouletteWheel<int, double>;
+    const std::vector<WheelRegion<int, double>> regions = {{1, 1.0}, {2, 3.0}};
+    for (const std::uint8_t engine : {std::uint8_t{0}, std::uint8_t{200}}) {  // Automatic, out of range
+        std::ostringstream stream;
+        {
+            cereal::BinaryOutputArchive archive(stream);
+            archive(regions, 1.0, 0.0, 1.0, std::uint64_t{0}, engine, 4.0, false);
+        }
+
+        Wheel::Options options;
+        options.serializeCaches = true;
+        Wheel loaded(options);
+        loadWheel(stream.str(), loaded);
+        EXPECT_NE(loaded.getActiveStrategy(), Wheel::Strategy::Automatic);
+        EXPECT_DOUBLE_EQ(loaded.getSelectionProbability(2), 0.75);
+        EXPECT_EQ(loaded.indexOf(2), std::optional<size_t>(1));
+    }
+}
+#endif
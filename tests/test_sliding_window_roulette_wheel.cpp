@@ -0,0 +1,98 @@
+#include "../SlidingWindowRouletteWheel.hpp"
+#include <gtest/gtest.h>
+#include <map>
+#include <string>
+#include <vector>
+
+class SlidingWindowRouletteWheelTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        wheel.seedRandom(42);
+    }
+
+    SlidingWindowRouletteWheel<std::string, double> wheel{3};
+};
+
+// Construction Tests
+TEST_F(SlidingWindowRouletteWheelTest, DefaultState) {
+    EXPECT_TRUE(wheel.empty());
+    EXPECT_FALSE(wheel.full());
+    EXPECT_EQ(wheel.capacity(), 3u);
+    EXPECT_THROW(wheel.select(), std::runtime_error);
+    EXPECT_FALSE(wheel.selectSafe().has_value());
+    EXPECT_THROW((SlidingWindowRouletteWheel<int, int>(0)), std::invalid_argument);
+}
+
+// Window Tests
+TEST_F(SlidingWindowRouletteWheelTest, AddEvictsTheOldestOnceFull) {
+    EXPECT_FALSE(wheel.addRegion("a", 1.0).has_value());
+    EXPECT_FALSE(wheel.addRegion("b", 2.0).has_value());
+    EXPECT_FALSE(wheel.addRegion("c", 3.0).has_value());
+    EXPECT_TRUE(wheel.full());
+
+    const auto evicted = wheel.addRegion("d", 4.0);
+    ASSERT_TRUE(evicted.has_value());
+    EXPECT_EQ(*evicted, "a");
+    EXPECT_EQ(wheel.size(), 3u);
+    EXPECT_DOUBLE_EQ(wheel.getTotalWeight(), 9.0);
+    EXPECT_EQ(wheel.getRegion(0).getElement(), "b");
+    EXPECT_EQ(wheel.getRegion(2).getElement(), "d");
+    EXPECT_THROW(wheel.getRegion(3), std::out_of_range);
+}
+
+TEST_F(SlidingWindowRouletteWheelTest, EvictOldestMakesRoomForLaterRegions) {
+    wheel.addRegion("a", 1.0);
+    wheel.addRegion("b", 2.0);
+    EXPECT_EQ(wheel.evictOldest(), std::optional<std::string>("a"));
+    wheel.addRegion("c", 3.0);
+    wheel.addRegion("d", 4.0);
+    EXPECT_TRUE(wheel.full());
+    EXPECT_DOUBLE_EQ(wheel.getTotalWeight(), 9.0);
+    EXPECT_EQ(wheel.getRegion(0).getElement(), "b");
+
+    wheel.clear();
+    EXPECT_TRUE(wheel.empty());
+    EXPECT_FALSE(wheel.evictOldest().has_value());
+    wheel.addRegion("e", 1.0);
+    EXPECT_EQ(wheel.select(), "e");
+}
+
+TEST_F(SlidingWindowRouletteWheelTest, RejectsNonPositiveWeights) {
+    EXPECT_THROW(wheel.addRegion("a", 0.0), std::invalid_argument);
+    EXPECT_THROW(wheel.addRegion("a", -1.0), std::invalid_argument);
+    EXPECT_TRUE(wheel.empty());
+}
+
+// Selection Tests
+TEST_F(SlidingWindowRouletteWheelTest, SelectsOnlyFromTheWindowByWeight) {
+    wheel.addRegion("old", 100.0);
+    wheel.addRegion("a", 1.0);
+    wheel.addRegion("b", 3.0);
+    wheel.addRegion("c", 6.0);
+
+    std::map<std::string, int> counts;
+    const int iterations = 20000;
+    for (int i = 0; i < iterations; ++i) {
+        ++counts[wheel.select()];
+    }
+    EXPECT_EQ(counts.count("old"), 0u);
+    EXPECT_NEAR(static_cast<double>(counts["a"]) / iterations, 0.1, 0.015);
+    EXPECT_NEAR(static_cast<double>(counts["b"]) / iterations, 0.3, 0.015);
+    EXPECT_NEAR(static_cast<double>(counts["c"]) / iterations, 0.6, 0.015);
+    EXPECT_DOUBLE_EQ(wheel.getSelectionProbability(2), 0.6);
+}
+
+TEST_F(SlidingWindowRouletteWheelTest, LongStreamsKeepTheTotalExact) {
+    SlidingWindowRouletteWheel<int, double> window(100);
+    for (int i = 0; i < 100000; ++i) {
+        window.addRegion(i, 0.1 + (i % 13) * 0.37);
+    }
+    double expected = 0.0;
+    for (size_t age = 0; age < window.size(); ++age) {
+        expected += window.getRegion(age).getWeight();
+    }
+    EXPECT_NEAR(window.getTotalWeight(), expected, 1e-9);
+    for (int i = 0; i < 1000; ++i) {
+        EXPECT_GE(window.select(), 99900);
+    }
+}
@@ -0,0 +1,131 @@
+#include "../StaticRouletteWheel.hpp"
+#include <gtest/gtest.h>
+#include <string>
+#include <type_traits>
+
+class StaticRouletteWheelTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        wheel.seedRandom(42);
+    }
+
+    StaticRouletteWheel<std::string, int, 4> wheel;
+};
+
+// Layout Tests
+TEST_F(StaticRouletteWheelTest, TriviallyCopyableForTrivialTypes) {
+    EXPECT_TRUE((std::is_trivially_copyable_v<StaticRouletteWheel<int, int, 8>>));
+    EXPECT_TRUE((std::is_trivially_copyable_v<StaticRouletteWheel<char, double, 16>>));
+    EXPECT_FALSE((std::is_trivially_copyable_v<StaticRouletteWheel<std::string, int, 4>>));
+}
+
+// Constructor Tests
+TEST_F(StaticRouletteWheelTest, DefaultConstructor) {
+    EXPECT_TRUE(wheel.empty());
+    EXPECT_EQ(wheel.size(), 0);
+    EXPECT_EQ(wheel.capacity(), 4);
+}
+
+TEST_F(StaticRouletteWheelTest, InitializerListConstructor) {
+    StaticRouletteWheel<int, int, 4> listWheel = {{1, 10}, {2, 30}, {1, 10}};
+
+    EXPECT_EQ(listWheel.size(), 2);
+    EXPECT_DOUBLE_EQ(listWheel.getSelectionProbability(1), 0.4);
+    EXPECT_DOUBLE_EQ(listWheel.getSelectionProbability(2), 0.6);
+}
+
+// Add Region Tests
+TEST_F(StaticRouletteWheelTest, AddRegionCombinesWeights) {
+    wheel.addRegion("item", 5);
+    wheel.addRegion("item", 3);
+
+    EXPECT_EQ(wheel.size(), 1);
+    EXPECT_EQ(wheel.begin()->getWeight(), 8);
+}
+
+TEST_F(StaticRouletteWheelTest, AddRegionThrowsOnInvalidWeight) {
+    EXPECT_THROW(wheel.addRegion("invalid", 0), std::invalid_argument);
+    EXPECT_THROW(wheel.addRegion("invalid", -1), std::invalid_argument);
+}
+
+TEST_F(StaticRouletteWheelTest, AddRegionThrowsWhenFull) {
+    wheel.addRegion("a", 1);
+    wheel.addRegion("b", 1);
+    wheel.emplaceRegion(1, "c");
+    wheel.emplaceRegion(1, "d");
+
+    EXPECT_TRUE(wheel.full());
+    EXPECT_THROW(wheel.addRegion("e", 1), std::length_error);
+    EXPECT_NO_THROW(wheel.addRegion("a", 1));
+}
+
+// Selection Tests
+TEST_F(StaticRouletteWheelTest, SelectThrowsOnEmptyWheel) {
+    EXPECT_THROW(wheel.select(), std::runtime_error);
+    EXPECT_FALSE(wheel.selectSafe().has_value());
+}
+
+TEST_F(StaticRouletteWheelTest, SelectDistribution) {
+    StaticRouletteWheel<char, int, 8> charWheel = {{'a', 90}, {'b', 10}};
+
+    int aCount = 0;
+    const int iterations = 10000;
+    for (int i = 0; i < iterations; ++i) {
+        if (charWheel.select() == 'a') {
+            ++aCount;
+        }
+    }
+
+    EXPECT_NEAR(aCount * 100.0 / iterations, 90.0, 2.0);
+}
+
+TEST_F(StaticRouletteWheelTest, SelectAndRemoveDrainsWheel) {
+    wheel.addRegion("a", 1);
+    wheel.addRegion("b", 2);
+    wheel.addRegion("c", 3);
+
+    std::string drawn;
+    while (!wheel.empty()) {
+        drawn += wheel.selectAndRemove();
+    }
+
+    EXPECT_EQ(drawn.size(), 3);
+    EXPECT_NE(drawn.find('a'), std::string::npos);
+    EXPECT_NE(drawn.find('b'), std::string::npos);
+    EXPECT_NE(drawn.find('c'), std::string::npos);
+    EXPECT_FALSE(wheel.selectAndRemoveSafe().has_value());
+}
+
+TEST_F(StaticRouletteWheelTest, SelectAndModifyWeightRemovesWhenZero) {
+    wheel.addRegion("item", 2);
+    wheel.selectAndModifyWeight(-1);
+    EXPECT_EQ(wheel.size(), 1);
+    wheel.selectAndModifyWeight(-1);
+    EXPECT_TRUE(wheel.empty());
+}
+
+// Removal Tests
+TEST_F(StaticRouletteWheelTest, RemoveElementKeepsOrder) {
+    wheel.addRegion("a", 1);
+    wheel.addRegion("b", 2);
+    wheel.addRegion("c", 3);
+
+    EXPECT_TRUE(wheel.removeElement("b"));
+    EXPECT_FALSE(wheel.removeElement("b"));
+
+    ASSERT_EQ(wheel.size(), 2);
+    EXPECT_EQ(wheel.begin()[0].getElement(), "a");
+    EXPECT_EQ(wheel.begin()[1].getElement(), "c");
+    EXPECT_DOUBLE_EQ(wheel.getSelectionProbability("c"), 0.75);
+}
+
+TEST_F(StaticRouletteWheelTest, CopyIsIndependent) {
+    StaticRouletteWheel<int, int, 8> original = {{1, 1}, {2, 1}};
+    StaticRouletteWheel<int, int, 8> copy = original;
+
+    copy.removeElement(1);
+
+    EXPECT_EQ(original.size(), 2);
+    EXPECT_EQ(copy.size(), 1);
+    EXPECT_EQ(copy.select(), 2);
+}
@@ -0,0 +1,157 @@
+#include "../WeightedReservoirSampler.hpp"
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <string>
+#include <vector>
+
+using Sampler = WeightedReservoirSampler<int, double>;
+
+class WeightedReservoirSamplerTest : public ::testing::TestWithParam<Sampler::Algorithm> {
+protected:
+    void SetUp() override {
+        WheelRandom::seed(42);
+        options.algorithm = GetParam();
+    }
+
+    /// Fraction of trials whose sample of two from {0: 1, 1: 1, 2: 1, 3: 7} contains each element
+    std::vector<double> inclusionFrequencies(int trials, bool sharded) const {
+        std::vector<double> frequencies(4, 0.0);
+        for (int trial = 0; trial < trials; ++trial) {
+            Sampler sampler(2, options);
+            Sampler shard(2, options);
+            sampler.offer(0, 1.0);
+            sampler.offer(1, 1.0);
+            (sharded ? shard : sampler).offer(2, 1.0);
+            (sharded ? shard : sampler).offer(3, 7.0);
+            if (sharded) {
+                sampler.merge(shard);
+            }
+            for (const auto& region : sampler.getSample()) {
+                frequencies[region.getElement()] += 1.0 / trials;
+            }
+        }
+        return frequencies;
+    }
+
+    Sampler::Options options;
+};
+
+// Construction Tests
+TEST_P(WeightedReservoirSamplerTest, StartsEmpty) {
+    const Sampler sampler(3, options);
+    EXPECT_TRUE(sampler.empty());
+    EXPECT_EQ(sampler.capacity(), 3u);
+    EXPECT_EQ(sampler.itemsOffered(), 0u);
+    EXPECT_TRUE(sampler.getSample().empty());
+    EXPECT_THROW(Sampler(0, options), std::invalid_argument);
+}
+
+// Offer Tests
+TEST_P(WeightedReservoirSamplerTest, KeepsEveryItemUntilFull) {
+    Sampler sampler(3, options);
+    EXPECT_TRUE(sampler.offer(1, 2.0));
+    EXPECT_TRUE(sampler.offer(2, 5.0));
+    EXPECT_EQ(sampler.size(), 2u);
+
+    for (int i = 3; i < 1000; ++i) {
+        sampler.offer(i, 1.0 + i % 7);
+    }
+    EXPECT_EQ(sampler.size(), 3u);
+    EXPECT_EQ(sampler.itemsOffered(), 999u);
+
+    const auto sample = sampler.getSample();
+    std::vector<int> elements;
+    for (const auto& region : sample) {
+        elements.push_back(region.getElement());
+    }
+    std::sort(elements.begin(), elements.end());
+    EXPECT_EQ(std::unique(elements.begin(), elements.end()), elements.end());
+}
+
+TEST_P(WeightedReservoirSamplerTest, InvalidWeightsAreSkippedOrRejected) {
+    Sampler sampler(2, options);
+    EXPECT_FALSE(sampler.offer(1, 0.0));
+    EXPECT_FALSE(sampler.offer(2, -1.0));
+    EXPECT_EQ(sampler.itemsOffered(), 0u);
+
+    Sampler::Options strict = options;
+    strict.ignoreInvalidWeights = false;
+    Sampler strictSampler(2, strict);
+    EXPECT_THROW(strictSampler.offer(1, 0.0), std::invalid_argument);
+}
+
+TEST_P(WeightedReservoirSamplerTest, MovesStringElements) {
+    WeightedReservoirSampler<std::string, int>::Options stringOptions;
+    stringOptions.algorithm = GetParam();
+    WeightedReservoirSampler<std::string, int> sampler(1, stringOptions);
+    std::string element = "log line";
+    sampler.offer(std::move(element), 3);
+    ASSERT_EQ(sampler.size(), 1u);
+    EXPECT_EQ(sampler.getSample()[0].getElement(), "log line");
+    EXPECT_EQ(sampler.getSample()[0].getWeight(), 3);
+}
+
+// Statistical Tests
+TEST_P(WeightedReservoirSamplerTest, SingleItemSampleIsProportionalToWeight) {
+    const std::vector<double> weights = {1.0, 2.0, 3.0, 4.0, 10.0};
+    std::vector<int> counts(weights.size(), 0);
+    const int trials = 20000;
+    for (int trial = 0; trial < trials; ++trial) {
+        Sampler sampler(1, options);
+        for (size_t i = 0; i < weights.size(); ++i) {
+            sampler.offer(static_cast<int>(i), weights[i]);
+        }
+        ++counts[sampler.getSample()[0].getElement()];
+    }
+    for (size_t i = 0; i < weights.size(); ++i) {
+        EXPECT_NEAR(static_cast<double>(counts[i]) / trials, weights[i] / 20.0, 0.015) << "element " << i;
+    }
+}
+
+TEST_P(WeightedReservoirSamplerTest, SampleMatchesDrawsWithoutReplacement) {
+    // Exact inclusion probabilities for two draws without replacement from weights {1, 1, 1, 7}
+    const std::vector<double> frequencies = inclusionFrequencies(20000, false);
+    EXPECT_NEAR(frequencies[3], 0.7 + 3 * 0.1 * 7.0 / 9.0, 0.015);
+    for (int i = 0; i < 3; ++i) {
+        EXPECT_NEAR(frequencies[i], 0.1 + 0.7 / 3.0 + 2 * 0.1 / 9.0, 0.015) << "element " << i;
+    }
+}
+
+// Merge Tests
+TEST_P(WeightedReservoirSamplerTest, MergedShardsSampleTheCombinedStream) {
+    const std::vector<double> frequencies = inclusionFrequencies(20000, true);
+    EXPECT_NEAR(frequencies[3], 0.7 + 3 * 0.1 * 7.0 / 9.0, 0.015);
+    for (int i = 0; i < 3; ++i) {
+        EXPECT_NEAR(frequencies[i], 0.1 + 0.7 / 3.0 + 2 * 0.1 / 9.0, 0.015) << "element " << i;
+    }
+}
+
+TEST_P(WeightedReservoirSamplerTest, MergeCombinesCountsAndChecksCapacity) {
+    Sampler left(2, options);
+    Sampler right(2, options);
+    left.offer(1, 1.0);
+    right.offer(2, 2.0);
+    right.offer(3, 3.0);
+    left.merge(right);
+
+    EXPECT_EQ(left.size(), 2u);
+    EXPECT_EQ(left.itemsOffered(), 3u);
+    EXPECT_DOUBLE_EQ(left.weightOffered(), 6.0);
+    EXPECT_THROW(left.merge(Sampler(3, options)), std::invalid_argument);
+
+    left.clear();
+    EXPECT_TRUE(left.empty());
+    EXPECT_EQ(left.itemsOffered(), 0u);
+}
+
+TEST_P(WeightedReservoirSamplerTest, MergeRejectsItself) {
+    Sampler sampler(4, options);  // Not full, so a self-merge would insert into the entries it reads
+    sampler.offer(1, 1.0);
+    sampler.offer(2, 2.0);
+    EXPECT_THROW(sampler.merge(sampler), std::invalid_argument);
+    EXPECT_EQ(sampler.size(), 2u);
+    EXPECT_EQ(sampler.itemsOffered(), 2u);
+}
+
+INSTANTIATE_TEST_SUITE_P(Algorithms, WeightedReservoirSamplerTest,
+                         ::testing::Values(Sampler::Algorithm::ReservoirKeys, Sampler::Algorithm::ExponentialJumps));
@@ -0,0 +1,219 @@
+#include "../WheelCsvReader.hpp"
+#include <gtest/gtest.h>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <string_view>
+
+// Allocator that counts every allocation made through it, so a string type using it shows
+// each copy of an element's text
+inline size_t countedAllocations = 0;
+
+template<typename T>
+struct CountingAllocator {
+    using value_type = T;
+
+    CountingAllocator() = default;
+
+    template<typename U>
+    CountingAllocator(const CountingAllocator<U>&) {}
+
+    T* allocate(size_t count) {
+        ++countedAllocations;
+        return std::allocator<T>().allocate(count);
+    }
+
+    void deallocate(T* pointer, size_t count) {
+        std::allocator<T>().deallocate(pointer, count);
+    }
+
+    template<typename U>
+    bool operator==(const CountingAllocator<U>&) const {
+        return true;
+    }
+
+    template<typename U>
+    bool operator!=(const CountingAllocator<U>&) const {
+        return false;
+    }
+};
+
+using CountedString = std::basic_string<char, std::char_traits<char>, CountingAllocator<char>>;
+
+namespace std {
+template<>
+struct hash<CountedString> {
+    size_t operator()(const CountedString& text) const {
+        return hash<string_view>()(string_view(text));
+    }
+};
+}
+
+class WheelCsvReaderTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        WheelRandom::seed(42);
+    }
+};
+
+// Parsing Tests
+TEST_F(WheelCsvReaderTest, ReadsCsvFromStream) {
+    std::istringstream in("sword,10\nshield, 30\n  potion ,60.5\n");
+    RouletteWheel<std::string, double> wheel;
+
+    const WheelCsvReader::Report report = WheelCsvReader().read(in, wheel);
+
+    EXPECT_TRUE(report.ok());
+    EXPECT_EQ(report.linesRead, 3u);
+    EXPECT_EQ(report.recordsAdded, 3u);
+    ASSERT_EQ(wheel.size(), 3u);
+    EXPECT_EQ(wheel.getRegions()[2].getElement(), "potion");
+    EXPECT_DOUBLE_EQ(wheel.getRegions()[2].getWeight(), 60.5);
+}
+
+TEST_F(WheelCsvReaderTest, ReadsTsvWithHeaderAndCrlf) {
+    WheelCsvReader::Format format;
+    format.delimiter = '\t';
+    format.hasHeader = true;
+    std::istringstream in("item\tweight\r\ncommon\t70\r\n\r\nrare\t30\r\n");
+    RouletteWheel<std::string, int> wheel;
+
+    const auto report = WheelCsvReader(format).read(in, wheel);
+
+    EXPECT_TRUE(report.ok());
+    EXPECT_EQ(report.recordsAdded, 2u);
+    EXPECT_DOUBLE_EQ(wheel.getSelectionProbability("rare"), 0.3);
+}
+
+TEST_F(WheelCsvReaderTest, ReadsQuotedElements) {
+    RouletteWheel<std::string, int> wheel;
+    const auto report = WheelCsvReader().read(std::string_view("\"Sword, Long\",5\n\"say \"\"hi\"\"\",5"), wheel);
+
+    EXPECT_TRUE(report.ok());
+    ASSERT_EQ(wheel.size(), 2u);
+    EXPECT_EQ(wheel.getRegions()[0].getElement(), "Sword, Long");
+    EXPECT_EQ(wheel.getRegions()[1].getElement(), "say \"hi\"");
+}
+
+TEST_F(WheelCsvReaderTest, ParsesNumericElementsAndCombinesDuplicates) {
+    RouletteWheel<int, int> wheel;
+    const auto report = WheelCsvReader().read(std::string_view("1,10\n2,20\n1,+5\n"), wheel);
+
+    EXPECT_TRUE(report.ok());
+    EXPECT_EQ(report.recordsAdded, 3u);
+    ASSERT_EQ(wheel.size(), 2u);
+    EXPECT_EQ(wheel.getRegions()[0].getWeight(), 15);
+}
+
+TEST_F(WheelCsvReaderTest, LinesSpanningChunksAreReassembled) {
+    std::string text;
+    for (int i = 0; i < 500; ++i) {
+        text += "element" + std::to_string(i) + "," + std::to_string(i + 1) + "\n";
+    }
+    WheelCsvReader::Format format;
+    format.chunkSize = 7;
+    std::istringstream in(text);
+    RouletteWheel<std::string, int> wheel;
+
+    const auto report = WheelCsvReader(format).read(in, wheel);
+
+    EXPECT_TRUE(report.ok());
+    ASSERT_EQ(wheel.size(), 500u);
+    EXPECT_EQ(wheel.getRegions()[499].getElement(), "element499");
+    EXPECT_EQ(wheel.getRegions()[499].getWeight(), 500);
+}
+
+// Error Reporting Tests
+TEST_F(WheelCsvReaderTest, ReportsMalformedLinesAndKeepsGoing) {
+    std::istringstream in("a,1\nno delimiter\nb,heavy\nc,1,2\n,4\n\"open,5\nd,2\n");
+    RouletteWheel<std::string, int> wheel;
+
+    const auto report = WheelCsvReader().read(in, wheel);
+
+    EXPECT_FALSE(report.ok());
+    EXPECT_EQ(report.recordsAdded, 2u);
+    EXPECT_EQ(report.malformedCount, 5u);
+    ASSERT_EQ(report.malformedLines.size(), 5u);
+    EXPECT_EQ(report.malformedLines[0].lineNumber, 2u);
+    EXPECT_EQ(report.malformedLines[0].reason, "missing delimiter");
+    EXPECT_EQ(report.malformedLines[1].reason, "weight is not a number");
+    EXPECT_EQ(report.malformedLines[1].text, "b,heavy");
+    EXPECT_EQ(report.malformedLines[2].reason, "expected 2 fields");
+    EXPECT_EQ(report.malformedLines[3].reason, "empty element");
+    EXPECT_EQ(report.malformedLines[4].reason, "unterminated quote");
+    EXPECT_EQ(wheel.size(), 2u);
+}
+
+TEST_F(WheelCsvReaderTest, ReportKeepsOnlyTheFirstMalformedLines) {
+    WheelCsvReader::Format format;
+    format.maxReportedLines = 2;
+    RouletteWheel<int, int> wheel;
+
+    const auto report = WheelCsvReader(format).read(std::string_view("x\ny\nz\n1,1\n"), wheel);
+
+    EXPECT_EQ(report.malformedCount, 3u);
+    EXPECT_EQ(report.malformedLines.size(), 2u);
+    EXPECT_EQ(wheel.size(), 1u);
+}
+
+TEST_F(WheelCsvReaderTest, NonPositiveWeightsFollowIgnoreInvalidWeights) {
+    RouletteWheel<std::string, int> lenient;
+    const auto report = WheelCsvReader().read(std::string_view("a,0\nb,-3\nc,4\n"), lenient);
+    EXPECT_TRUE(report.ok());
+    EXPECT_EQ(report.invalidWeights, 2u);
+    EXPECT_EQ(lenient.size(), 1u);
+
+    RouletteWheel<std::string, int> strict(RouletteWheel<std::string, int>::Options{false});
+    EXPECT_THROW(WheelCsvReader().read(std::string_view("a,1\nb,0\n"), strict), std::invalid_argument);
+    EXPECT_EQ(strict.size(), 1u);
+}
+
+TEST_F(WheelCsvReaderTest, RejectsUnusableFormats) {
+    WheelCsvReader::Format format;
+    format.delimiter = '"';
+    EXPECT_THROW(WheelCsvReader{format}, std::invalid_argument);
+}
+
+// Allocation Tests
+TEST_F(WheelCsvReaderTest, EachElementIsAllocatedOnce) {
+    std::string text;
+    for (int i = 0; i < 500; ++i) {
+        text += "Loot table entry with a long name #" + std::to_string(i) + "," + std::to_string(i + 1) + "\n";
+    }
+
+    for (bool indexElements : {false, true}) {
+        RouletteWheel<CountedString, int>::Options options;
+        options.indexElements = indexElements;
+        RouletteWheel<CountedString, int> wheel(options);
+        countedAllocations = 0;
+
+        const auto report = WheelCsvReader().read(std::string_view(text), wheel);
+
+        EXPECT_TRUE(report.ok());
+        ASSERT_EQ(wheel.size(), 500u);
+        // One buffer per element, owned by its region: the wheel keeps no second copy
+        EXPECT_EQ(countedAllocations, 500u);
+        EXPECT_EQ(wheel.indexOf(CountedString("Loot table entry with a long name #499")),
+                  std::optional<size_t>(499));
+    }
+}
+
+// Mapped File Tests
+TEST_F(WheelCsvReaderTest, ReadsMappedFile) {
+    const auto path = std::filesystem::temp_directory_path() / "roulette_wheel_csv_reader_test.csv";
+    {
+        std::ofstream out(path, std::ios::binary);
+        out << "gold,75\nsilver,25";
+    }
+    RouletteWheel<std::string, double> wheel;
+    {
+        const MappedFile file(path.string());
+        const auto report = WheelCsvReader().read(file, wheel);
+        EXPECT_TRUE(report.ok());
+    }
+    std::filesystem::remove(path);
+
+    ASSERT_EQ(wheel.size(), 2u);
+    EXPECT_DOUBLE_EQ(wheel.getSelectionProbability("gold"), 0.75);
+}
@@ -0,0 +1,110 @@
+#include "../WheelPool.hpp"
+#include "../RouletteWheel.hpp"
+#include <gtest/gtest.h>
+#include <string>
+#include <vector>
+
+class WheelPoolTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        pool.seedRandom(42);
+    }
+
+    WheelPool<std::string, int> pool;
+};
+
+// Construction Tests
+TEST_F(WheelPoolTest, DefaultState) {
+    EXPECT_TRUE(pool.empty());
+    EXPECT_EQ(pool.wheelCount(), 0u);
+    EXPECT_EQ(pool.size(), 0u);
+    EXPECT_THROW(pool.select(0), std::out_of_range);
+
+    std::vector<std::string> draws;
+    pool.selectAll(std::back_inserter(draws));
+    EXPECT_TRUE(draws.empty());
+}
+
+TEST_F(WheelPoolTest, AddWheelAssignsConsecutiveIds) {
+    EXPECT_EQ(pool.addWheel({{"attack", 3}, {"defend", 1}}), 0u);
+    EXPECT_EQ(pool.addWheel({{"graze", 1}}), 1u);
+
+    EXPECT_EQ(pool.wheelCount(), 2u);
+    EXPECT_EQ(pool.size(), 3u);
+    EXPECT_EQ(pool.wheelSize(0), 2u);
+    EXPECT_EQ(pool.getElement(0, 1), "defend");
+    EXPECT_EQ(pool.getTotalWeight(0), 4);
+    EXPECT_DOUBLE_EQ(pool.getSelectionProbability(0, 0), 0.75);
+    EXPECT_THROW(pool.getElement(1, 1), std::out_of_range);
+}
+
+TEST_F(WheelPoolTest, InvalidWheelsThrow) {
+    EXPECT_THROW(pool.addWheel({}), std::invalid_argument);
+    EXPECT_THROW(pool.addWheel({{"a", 1}, {"b", 0}}), std::invalid_argument);
+    EXPECT_TRUE(pool.empty());
+    EXPECT_EQ(pool.size(), 0u);
+
+    pool.addWheel({{"a", 1}});
+    EXPECT_THROW(pool.setWeight(0, 0, -1), std::invalid_argument);
+    EXPECT_THROW(pool.setWeight(0, 1, 1), std::out_of_range);
+}
+
+// Selection Tests
+TEST_F(WheelPoolTest, SelectAllDrawsOncePerWheel) {
+    pool.addWheel({{"a", 1}});
+    pool.addWheel({{"b", 1}, {"c", 1}});
+    pool.addWheel({{"d", 5}});
+
+    std::vector<std::string> draws;
+    pool.selectAll(std::back_inserter(draws));
+    ASSERT_EQ(draws.size(), 3u);
+    EXPECT_EQ(draws[0], "a");
+    EXPECT_TRUE(draws[1] == "b" || draws[1] == "c");
+    EXPECT_EQ(draws[2], "d");
+
+    std::vector<std::string> shard(1);
+    pool.selectRange(2, 3, shard.begin());
+    EXPECT_EQ(shard[0], "d");
+    EXPECT_THROW(pool.selectRange(2, 4, shard.begin()), std::out_of_range);
+}
+
+TEST_F(WheelPoolTest, DistributionMatchesWeights) {
+    // One small wheel searched by counting and one large wheel searched by bisection
+    pool.addWheel({{"rare", 1}, {"common", 3}, {"other", 1}});
+    pool.setWeight(0, 0, 2);
+    EXPECT_EQ(pool.getTotalWeight(0), 6);
+
+    std::vector<std::tuple<std::string, int>> large;
+    for (int i = 0; i < 100; ++i) {
+        large.emplace_back(std::to_string(i), i == 7 ? 100 : 1);
+    }
+    pool.addWheel(large);
+
+    int commonCount = 0;
+    int sevenCount = 0;
+    const int iterations = 10000;
+    std::vector<std::string> draws(2);
+    for (int i = 0; i < iterations; ++i) {
+        pool.selectAll(draws.begin());
+        commonCount += draws[0] == "common";
+        sevenCount += draws[1] == "7";
+    }
+
+    EXPECT_NEAR(commonCount * 100.0 / iterations, 50.0, 2.0);
+    EXPECT_NEAR(sevenCount * 100.0 / iterations, 100.0 * 100.0 / 199.0, 2.0);
+}
+
+TEST_F(WheelPoolTest, FloatingPointWeights) {
+    WheelPool<int, double> weighted;
+    weighted.addWheel({{1, 0.1}, {2, 0.3}});
+    EXPECT_DOUBLE_EQ(weighted.getSelectionProbability(0, 1), 0.75);
+
+    weighted.setWeight(0, 1, 0.1);
+    EXPECT_DOUBLE_EQ(weighted.getTotalWeight(0), 0.2);
+
+    int oneCount = 0;
+    for (int i = 0; i < 10000; ++i) {
+        oneCount += weighted.select(0) == 1;
+    }
+    EXPECT_NEAR(oneCount / 100.0, 50.0, 2.0);
+}
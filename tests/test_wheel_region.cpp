@@ -33,6 +33,19 @@ TEST_F(WheelRegionTest, ParametricConstructorFloat) {
     EXPECT_FLOAT_EQ(region.getWeight(), 3.14f);
 }
 
+TEST_F(WheelRegionTest, InPlaceConstructor) {
+    WheelRegion<std::string, int> region(std::in_place, 7, 3, 'z');
+    EXPECT_EQ(region.getElement(), "zzz");
+    EXPECT_EQ(region.getWeight(), 7);
+}
+
+TEST_F(WheelRegionTest, ExtractElement) {
+    WheelRegion<std::string, int> region("a fairly long element name to defeat SSO", 1);
+    std::string element = region.extractElement();
+    EXPECT_EQ(element, "a fairly long element name to defeat SSO");
+    EXPECT_EQ(region.getWeight(), 1);
+}
+
 TEST_F(WheelRegionTest, SetWeight) {
     WheelRegion<int, double> region(5, 1.0);
     EXPECT_DOUBLE_EQ(region.getWeight(), 1.0);